@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "jobsystem.h"
+
+#include "exception/argument.h"
+
+using namespace std;
+
+namespace reone {
+
+static thread_local const JobSystem *g_currentJobSystem = nullptr;
+static thread_local int g_currentWorkerIdx = -1;
+
+JobSystem::JobSystem(int numThreads) {
+    if (numThreads <= 0) {
+        numThreads = max(1, static_cast<int>(thread::hardware_concurrency()));
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        _workers.push_back(make_unique<Worker>());
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        _workers[i]->thread = thread(bind(&JobSystem::workerThreadFunc, this, i));
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        lock_guard<mutex> lock(_wakeMutex);
+        _stopping = true;
+    }
+    _wakeCondition.notify_all();
+    for (auto &worker : _workers) {
+        worker->thread.join();
+    }
+}
+
+void JobSystem::submit(Job job, JobGroup &group) {
+    ++group._pending;
+
+    int workerIdx = currentWorkerIndex();
+    if (workerIdx == -1) {
+        workerIdx = _nextWorker++ % static_cast<int>(_workers.size());
+    }
+    auto &worker = *_workers[workerIdx];
+    {
+        lock_guard<mutex> lock(worker.mutex);
+        worker.jobs.push_back(QueuedJob {move(job), &group});
+    }
+    ++_numQueued;
+
+    // Synchronize with workers about to sleep, so that the notification is not lost
+    {
+        lock_guard<mutex> lock(_wakeMutex);
+    }
+    _wakeCondition.notify_one();
+}
+
+void JobSystem::wait(JobGroup &group) {
+    int workerIdx = currentWorkerIndex();
+    while (group._pending > 0) {
+        if (!tryRunPending(workerIdx)) {
+            this_thread::yield();
+        }
+    }
+    if (group._exception) {
+        auto exception = group._exception;
+        group._exception = nullptr;
+        rethrow_exception(exception);
+    }
+}
+
+void JobSystem::parallelFor(int begin, int end, int grainSize, const function<void(int, int)> &fn) {
+    if (begin >= end) {
+        return;
+    }
+    grainSize = max(1, grainSize);
+
+    JobGroup group;
+    for (int chunkBegin = begin; chunkBegin < end; chunkBegin += min(grainSize, end - chunkBegin)) {
+        int chunkEnd = chunkBegin + min(grainSize, end - chunkBegin);
+        submit([&fn, chunkBegin, chunkEnd]() { fn(chunkBegin, chunkEnd); }, group);
+    }
+    wait(group);
+}
+
+void JobSystem::workerThreadFunc(int index) {
+    g_currentJobSystem = this;
+    g_currentWorkerIdx = index;
+
+    while (true) {
+        if (tryRunPending(index)) {
+            continue;
+        }
+        unique_lock<mutex> lock(_wakeMutex);
+        _wakeCondition.wait(lock, [this]() { return _stopping || _numQueued > 0; });
+        if (_stopping && _numQueued == 0) {
+            break;
+        }
+    }
+}
+
+bool JobSystem::tryRunPending(int workerIdx) {
+    QueuedJob job;
+    if ((workerIdx != -1 && tryPop(workerIdx, job)) || trySteal(workerIdx, job)) {
+        run(job);
+        return true;
+    }
+    return false;
+}
+
+bool JobSystem::tryPop(int workerIdx, QueuedJob &job) {
+    auto &worker = *_workers[workerIdx];
+    lock_guard<mutex> lock(worker.mutex);
+    if (worker.jobs.empty()) {
+        return false;
+    }
+    job = move(worker.jobs.back());
+    worker.jobs.pop_back();
+    --_numQueued;
+    return true;
+}
+
+bool JobSystem::trySteal(int thiefIdx, QueuedJob &job) {
+    int numWorkers = static_cast<int>(_workers.size());
+    for (int i = 1; i <= numWorkers; ++i) {
+        int victimIdx = (max(0, thiefIdx) + i) % numWorkers;
+        if (victimIdx == thiefIdx) {
+            continue;
+        }
+        auto &victim = *_workers[victimIdx];
+        lock_guard<mutex> lock(victim.mutex);
+        if (victim.jobs.empty()) {
+            continue;
+        }
+        job = move(victim.jobs.front());
+        victim.jobs.pop_front();
+        --_numQueued;
+        return true;
+    }
+    return false;
+}
+
+void JobSystem::run(QueuedJob &job) {
+    try {
+        job.job();
+    } catch (...) {
+        lock_guard<mutex> lock(job.group->_exceptionMutex);
+        if (!job.group->_exception) {
+            job.group->_exception = current_exception();
+        }
+    }
+    // Group may be destroyed as soon as it has no pending jobs
+    --job.group->_pending;
+}
+
+int JobSystem::currentWorkerIndex() const {
+    return g_currentJobSystem == this ? g_currentWorkerIdx : -1;
+}
+
+TaskGraph::TaskId TaskGraph::add(JobSystem::Job job, const vector<TaskId> &dependencies) {
+    auto id = static_cast<TaskId>(_tasks.size());
+    for (auto &dependency : dependencies) {
+        if (dependency < 0 || dependency >= id) {
+            throw ArgumentException("Task dependency must be a previously added task: " + to_string(dependency));
+        }
+    }
+    auto task = make_unique<Task>();
+    task->job = move(job);
+    task->numDependencies = static_cast<int>(dependencies.size());
+    for (auto &dependency : dependencies) {
+        _tasks[dependency]->dependents.push_back(id);
+    }
+    _tasks.push_back(move(task));
+    return id;
+}
+
+void TaskGraph::run(JobSystem &jobSystem) {
+    for (auto &task : _tasks) {
+        task->numPending = task->numDependencies;
+    }
+    JobSystem::JobGroup group;
+    for (TaskId id = 0; id < numTasks(); ++id) {
+        if (_tasks[id]->numDependencies == 0) {
+            submit(jobSystem, group, id);
+        }
+    }
+    jobSystem.wait(group);
+}
+
+void TaskGraph::submit(JobSystem &jobSystem, JobSystem::JobGroup &group, TaskId id) {
+    auto job = [this, &jobSystem, &group, id]() {
+        auto &task = *_tasks[id];
+        task.job();
+        for (auto &dependentId : task.dependents) {
+            if (--_tasks[dependentId]->numPending == 0) {
+                submit(jobSystem, group, dependentId);
+            }
+        }
+    };
+    jobSystem.submit(move(job), group);
+}
+
+} // namespace reone
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+/**
+ * Pool of worker threads executing jobs. Every worker owns a queue of jobs:
+ * jobs submitted by a worker are pushed to and popped from the back of its
+ * own queue, while idle workers steal jobs from the front of other queues.
+ * Jobs submitted from outside the pool are distributed between workers in
+ * a round-robin fashion.
+ *
+ * Threads waiting for a group of jobs help executing pending jobs, so jobs
+ * are free to submit and wait for nested jobs.
+ */
+class JobSystem : boost::noncopyable {
+public:
+    typedef std::function<void()> Job;
+
+    /**
+     * Tracks completion of a group of jobs.
+     */
+    class JobGroup : boost::noncopyable {
+    public:
+        bool isDone() const { return _pending == 0; }
+
+    private:
+        std::atomic<int> _pending {0};
+
+        std::mutex _exceptionMutex;
+        std::exception_ptr _exception;
+
+        friend class JobSystem;
+    };
+
+    /**
+     * @param numThreads number of worker threads, or 0 to match the number of hardware threads
+     */
+    JobSystem(int numThreads = 0);
+    ~JobSystem();
+
+    void submit(Job job, JobGroup &group);
+
+    /**
+     * Blocks until all jobs in a group are complete, executing pending jobs
+     * on the calling thread meanwhile.
+     *
+     * @throws first exception thrown by a job in the group
+     */
+    void wait(JobGroup &group);
+
+    /**
+     * Splits a range into chunks of at most grainSize elements, processes
+     * them in parallel and waits for completion.
+     *
+     * @param fn function called with begin and end of every chunk
+     */
+    void parallelFor(int begin, int end, int grainSize, const std::function<void(int, int)> &fn);
+
+    int numThreads() const { return static_cast<int>(_workers.size()); }
+
+private:
+    struct QueuedJob {
+        Job job;
+        JobGroup *group {nullptr};
+    };
+
+    struct Worker {
+        std::thread thread;
+        std::mutex mutex;
+        std::deque<QueuedJob> jobs;
+    };
+
+    std::vector<std::unique_ptr<Worker>> _workers;
+    std::atomic<int> _nextWorker {0};
+    std::atomic<int> _numQueued {0};
+
+    std::mutex _wakeMutex;
+    std::condition_variable _wakeCondition;
+    bool _stopping {false};
+
+    void workerThreadFunc(int index);
+
+    bool tryRunPending(int workerIdx);
+    bool tryPop(int workerIdx, QueuedJob &job);
+    bool trySteal(int thiefIdx, QueuedJob &job);
+    void run(QueuedJob &job);
+
+    /**
+     * @return index of the worker running on the calling thread, or -1 if the calling thread is not a worker of this pool
+     */
+    int currentWorkerIndex() const;
+};
+
+/**
+ * Graph of tasks, where every task is started only after all of its
+ * dependencies are complete. The same graph can be run repeatedly.
+ */
+class TaskGraph : boost::noncopyable {
+public:
+    typedef int TaskId;
+
+    /**
+     * @param dependencies tasks that must complete before this one, all previously added to this graph
+     * @return identifier of the added task
+     */
+    TaskId add(JobSystem::Job job, const std::vector<TaskId> &dependencies = std::vector<TaskId>());
+
+    /**
+     * Runs all tasks using the specified job system and waits for completion.
+     * Tasks depending on a task that has thrown an exception are not run.
+     */
+    void run(JobSystem &jobSystem);
+
+    int numTasks() const { return static_cast<int>(_tasks.size()); }
+
+private:
+    struct Task {
+        JobSystem::Job job;
+        std::vector<TaskId> dependents;
+        int numDependencies {0};
+        std::atomic<int> numPending {0}; /**< dependencies not yet complete during a run */
+    };
+
+    std::vector<std::unique_ptr<Task>> _tasks;
+
+    void submit(JobSystem &jobSystem, JobSystem::JobGroup &group, TaskId id);
+};
+
+} // namespace reone
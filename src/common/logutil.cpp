@@ -27,14 +27,14 @@ namespace reone {
 
 static constexpr char kLogFilename[] = "reone.log";
 
-static thread::id g_mainThreadId;
+static atomic<int> g_channels {LogChannels::general};
+static atomic<LogLevel> g_level {LogLevel::Info};
 
-static int g_channels = LogChannels::general;
-static LogLevel g_level = LogLevel::Info;
-
-static bool g_logToFile = false;
+static atomic<bool> g_logToFile {false};
 static unique_ptr<fs::ofstream> g_logFile;
 
+static mutex g_syncLogMutex; /**< guards writing to the log output */
+
 static const unordered_map<LogLevel, string> g_nameByLogLevel {
     {LogLevel::Error, "ERR"},
     {LogLevel::Warn, "WRN"},
@@ -47,10 +47,182 @@ static string describeLogLevel(LogLevel level) {
     });
 }
 
-static void log(ostream &out, LogLevel level, const string &s, int channel) {
-    auto msg = boost::format("%s %s") % describeLogLevel(level) % s;
-    out << msg << endl;
-}
+struct LogMessage {
+    atomic<LogMessage *> next {nullptr};
+    LogLevel level {LogLevel::None};
+    string text;
+};
+
+/**
+ * Intrusive lock-free multi-producer single-consumer queue of log messages.
+ *
+ * http://www.1024cores.net/home/lock-free-algorithms/queues/intrusive-mpsc-node-based-queue
+ */
+class LogQueue : boost::noncopyable {
+public:
+    LogQueue() :
+        _head(&_stub),
+        _tail(&_stub) {
+    }
+
+    ~LogQueue() {
+        for (auto message = pop(); message; message = pop()) {
+            delete message;
+        }
+    }
+
+    void push(LogMessage *message) {
+        message->next.store(nullptr, memory_order_relaxed);
+        auto prev = _head.exchange(message, memory_order_acq_rel);
+        prev->next.store(message, memory_order_release);
+    }
+
+    /**
+     * @return oldest message or nullptr, if queue is empty or a producer is mid-push
+     */
+    LogMessage *pop() {
+        auto tail = _tail;
+        auto next = tail->next.load(memory_order_acquire);
+        if (tail == &_stub) {
+            if (!next) {
+                return nullptr;
+            }
+            _tail = next;
+            tail = next;
+            next = next->next.load(memory_order_acquire);
+        }
+        if (next) {
+            _tail = next;
+            return tail;
+        }
+        if (tail != _head.load(memory_order_acquire)) {
+            return nullptr;
+        }
+        push(&_stub);
+        next = tail->next.load(memory_order_acquire);
+        if (next) {
+            _tail = next;
+            return tail;
+        }
+        return nullptr;
+    }
+
+private:
+    atomic<LogMessage *> _head;
+    LogMessage *_tail; /**< accessed only by the consumer */
+    LogMessage _stub;
+};
+
+/**
+ * Background thread, that writes queued log messages and flushes the
+ * output once per batch. Errors are written synchronously, together with
+ * messages queued before them.
+ */
+class LogWriter : boost::noncopyable {
+public:
+    ~LogWriter() {
+        stop();
+    }
+
+    void start() {
+        if (_thread.joinable()) {
+            return;
+        }
+        _stopping = false;
+        _thread = thread(bind(&LogWriter::threadFunc, this));
+    }
+
+    void stop() {
+        if (!_thread.joinable()) {
+            return;
+        }
+        {
+            lock_guard<mutex> lock(_wakeMutex);
+            _stopping = true;
+        }
+        _wakeCondition.notify_one();
+        _thread.join();
+    }
+
+    void enqueue(LogLevel level, string text) {
+        auto message = new LogMessage();
+        message->level = level;
+        message->text = move(text);
+        _queue.push(message);
+
+        // Only the first message of a batch needs to wake the writer
+        if (!_pending.exchange(true)) {
+            lock_guard<mutex> lock(_wakeMutex);
+            _wakeCondition.notify_one();
+        }
+    }
+
+    void write(LogLevel level, const string &text) {
+        lock_guard<mutex> lock(g_syncLogMutex);
+        auto &out = writeQueued();
+        out << describeLogLevel(level) << " " << text << endl;
+    }
+
+    bool isRunning() const {
+        return _thread.joinable();
+    }
+
+private:
+    LogQueue _queue;
+    thread _thread;
+    atomic<bool> _stopping {false};
+    atomic<bool> _pending {false}; /**< messages were queued since the writer last woke up */
+
+    mutex _wakeMutex;
+    condition_variable _wakeCondition;
+
+    void threadFunc() {
+        while (true) {
+            {
+                unique_lock<mutex> lock(_wakeMutex);
+                _wakeCondition.wait(lock, [this]() { return _pending || _stopping; });
+            }
+            // Reset before writing, so that messages queued during the write wake the writer again
+            _pending = false;
+            bool stopping = _stopping;
+            {
+                lock_guard<mutex> lock(g_syncLogMutex);
+                writeQueued().flush();
+            }
+            if (stopping) {
+                break;
+            }
+        }
+    }
+
+    /**
+     * Writes queued messages. Must be called with g_syncLogMutex locked.
+     *
+     * @return log output
+     */
+    ostream &writeQueued() {
+        auto &out = output();
+        for (auto message = _queue.pop(); message; message = _queue.pop()) {
+            out << describeLogLevel(message->level) << " " << message->text << "\n";
+            delete message;
+        }
+        return out;
+    }
+
+    ostream &output() {
+        if (!g_logToFile) {
+            return cout;
+        }
+        if (!g_logFile) {
+            fs::path path(fs::current_path());
+            path.append(kLogFilename);
+            g_logFile = make_unique<fs::ofstream>(path);
+        }
+        return *g_logFile;
+    }
+};
+
+static LogWriter g_logWriter;
 
 static void log(LogLevel level, const string &s, int channel) {
     if (!isLogLevelEnabled(level)) {
@@ -59,20 +231,22 @@ static void log(LogLevel level, const string &s, int channel) {
     if (!isLogChannelEnabled(channel)) {
         return;
     }
-    if (this_thread::get_id() != g_mainThreadId) {
-        throw logic_error("Must not log outside the main thread");
-    }
-    if (g_logToFile && !g_logFile) {
-        fs::path path(fs::current_path());
-        path.append(kLogFilename);
-        g_logFile = make_unique<fs::ofstream>(path);
+    if (g_logWriter.isRunning()) {
+        if (level == LogLevel::Error) {
+            // Errors must not be lost if the process crashes right after
+            g_logWriter.write(level, s);
+        } else {
+            g_logWriter.enqueue(level, s);
+        }
+        return;
     }
-    auto &out = g_logToFile ? *g_logFile : cout;
-    log(out, level, s, channel);
+    // Before initLog, write synchronously
+    lock_guard<mutex> lock(g_syncLogMutex);
+    cout << describeLogLevel(level) << " " << s << endl;
 }
 
 void initLog() {
-    g_mainThreadId = this_thread::get_id();
+    g_logWriter.start();
 }
 
 void error(const string &s, int channel) {
@@ -108,7 +282,7 @@ void debug(const boost::format &s, int channel) {
 }
 
 bool isLogLevelEnabled(LogLevel level) {
-    return static_cast<int>(level) <= static_cast<int>(g_level);
+    return static_cast<int>(level) <= static_cast<int>(g_level.load());
 }
 
 bool isLogChannelEnabled(int channel) {
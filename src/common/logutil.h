@@ -21,6 +21,10 @@
 
 namespace reone {
 
+/**
+ * Starts a background thread, that writes log messages from any thread.
+ * Until then, messages are written synchronously.
+ */
 void initLog();
 
 void error(const std::string &s, int channel = LogChannels::general);
@@ -35,8 +39,24 @@ void debug(const boost::format &s, int channel = LogChannels::general);
 bool isLogLevelEnabled(LogLevel level);
 bool isLogChannelEnabled(int channel);
 
+inline bool isLogEnabled(LogLevel level, int channel) {
+    return isLogLevelEnabled(level) && isLogChannelEnabled(channel);
+}
+
 void setLogLevel(LogLevel level);
 void setLogChannels(int mask);
 void setLogToFile(bool log);
 
 } // namespace reone
+
+/**
+ * Logs a debug message to the specified channel. Unlike debug(), message
+ * expression is only evaluated when both debug level and channel are
+ * enabled.
+ */
+#define R_DEBUG(message, channel)                                   \
+    do {                                                            \
+        if (reone::isLogEnabled(reone::LogLevel::Debug, channel)) { \
+            reone::debug(message, channel);                         \
+        }                                                           \
+    } while (false)
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+/**
+ * Hierarchical timer wheel. Values are scheduled to expire after a delay,
+ * rounded to the tick length. Scheduling and expiring a value are O(1):
+ * each wheel level covers 64 times the range of the level below it, and
+ * values cascade down one level at a time as time advances.
+ */
+template <class T>
+class TimerWheel : boost::noncopyable {
+public:
+    /**
+     * @param tickLength timer resolution in seconds
+     */
+    TimerWheel(float tickLength = 0.01f) :
+        _tickLength(tickLength) {
+    }
+
+    /**
+     * Schedules a value to expire after a given amount of seconds. Values
+     * expire no sooner than on the next tick.
+     */
+    void schedule(float delay, T value) {
+        uint64_t ticks = std::max(1ll, std::llround(delay / _tickLength));
+        uint64_t expiry = _now + std::min(ticks, kMaxTicks);
+        insert(Timer {expiry, std::move(value)}, _now);
+        ++_size;
+    }
+
+    /**
+     * Advances this wheel by a given amount of seconds, appending expired
+     * values to the specified vector, in order of expiry.
+     */
+    void advance(float secs, std::vector<T> &expired) {
+        _remainder += secs;
+        auto ticks = static_cast<uint64_t>(_remainder / _tickLength);
+        _remainder -= ticks * _tickLength;
+
+        // Empty wheel needs no processing
+        uint64_t i = 0;
+        for (; i < ticks && _size > 0; ++i) {
+            tick(expired);
+        }
+        _now += ticks - i;
+    }
+
+    void clear() {
+        for (auto &level : _wheels) {
+            for (auto &slot : level) {
+                slot.clear();
+            }
+        }
+        _size = 0;
+    }
+
+    int size() const { return _size; }
+
+private:
+    static constexpr int kNumLevels = 4;
+    static constexpr int kSlotBits = 6;
+    static constexpr int kNumSlots = 1 << kSlotBits;
+    static constexpr uint64_t kSlotMask = kNumSlots - 1;
+    static constexpr uint64_t kMaxTicks = (1ull << (kNumLevels * kSlotBits)) - 1;
+
+    struct Timer {
+        uint64_t expiry {0};
+        T value;
+    };
+
+    float _tickLength;
+    float _remainder {0.0f};
+    uint64_t _now {0}; /**< last processed tick */
+    int _size {0};
+
+    std::vector<Timer> _wheels[kNumLevels][kNumSlots];
+
+    void insert(Timer timer, uint64_t reference) {
+        uint64_t delta = timer.expiry - reference;
+        int level = 0;
+        while (level < kNumLevels - 1 && delta >= (1ull << ((level + 1) * kSlotBits))) {
+            ++level;
+        }
+        int slot = static_cast<int>((timer.expiry >> (level * kSlotBits)) & kSlotMask);
+        _wheels[level][slot].push_back(std::move(timer));
+    }
+
+    void tick(std::vector<T> &expired) {
+        uint64_t now = _now + 1;
+
+        // Cascade timers from higher levels, highest first
+        int levels = 0;
+        while (levels < kNumLevels - 1 && ((now >> (levels * kSlotBits)) & kSlotMask) == 0) {
+            ++levels;
+        }
+        for (int level = levels; level > 0; --level) {
+            int slot = static_cast<int>((now >> (level * kSlotBits)) & kSlotMask);
+            auto timers = std::move(_wheels[level][slot]);
+            _wheels[level][slot].clear();
+            for (auto &timer : timers) {
+                insert(std::move(timer), now);
+            }
+        }
+
+        auto &slot = _wheels[0][now & kSlotMask];
+        for (auto &timer : slot) {
+            expired.push_back(std::move(timer.value));
+        }
+        _size -= static_cast<int>(slot.size());
+        slot.clear();
+
+        _now = now;
+    }
+};
+
+} // namespace reone
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "traceutil.h"
+
+#include "textwriter.h"
+
+using namespace std;
+
+namespace reone {
+
+static constexpr int kMaxEventsPerThread = 1 << 20;
+
+struct TraceEvent {
+    const char *name {nullptr};
+    int64_t startNanos {0};
+    int64_t durationNanos {0};
+};
+
+struct TraceBuffer {
+    int threadId {0};
+    mutex eventsMutex; /**< only contended while saving trace */
+    vector<TraceEvent> events;
+};
+
+static atomic<bool> g_tracingEnabled {false};
+static const chrono::steady_clock::time_point g_traceEpoch = chrono::steady_clock::now();
+
+static mutex g_traceBuffersMutex;
+static vector<shared_ptr<TraceBuffer>> g_traceBuffers;
+
+static int64_t getTraceNanos() {
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - g_traceEpoch).count();
+}
+
+static TraceBuffer &getThreadTraceBuffer() {
+    static thread_local shared_ptr<TraceBuffer> buffer;
+    if (!buffer) {
+        buffer = make_shared<TraceBuffer>();
+        lock_guard<mutex> lock(g_traceBuffersMutex);
+        buffer->threadId = static_cast<int>(g_traceBuffers.size()) + 1;
+        g_traceBuffers.push_back(buffer);
+    }
+    return *buffer;
+}
+
+static string escapeJson(const char *s) {
+    string result;
+    for (; *s; ++s) {
+        if (*s == '"' || *s == '\\') {
+            result += '\\';
+        }
+        result += *s;
+    }
+    return move(result);
+}
+
+void setTracingEnabled(bool enabled) {
+    g_tracingEnabled = enabled;
+}
+
+bool isTracingEnabled() {
+    return g_tracingEnabled;
+}
+
+void saveTrace(IOutputStream &stream) {
+    TextWriter writer(stream);
+    writer.putLine("{\"traceEvents\":[");
+
+    bool first = true;
+    lock_guard<mutex> lock(g_traceBuffersMutex);
+    for (auto &buffer : g_traceBuffers) {
+        lock_guard<mutex> bufferLock(buffer->eventsMutex);
+        for (auto &event : buffer->events) {
+            if (!first) {
+                writer.putLine(",");
+            }
+            writer.put(str(boost::format("{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d}") %
+                           escapeJson(event.name) %
+                           (event.startNanos / 1e3) %
+                           (event.durationNanos / 1e3) %
+                           buffer->threadId));
+            first = false;
+        }
+    }
+
+    writer.putLine("");
+    writer.putLine("]}");
+}
+
+TraceZone::TraceZone(const char *name) :
+    _name(name) {
+    if (g_tracingEnabled) {
+        _startNanos = getTraceNanos();
+    }
+}
+
+TraceZone::~TraceZone() {
+    if (_startNanos == -1) {
+        return;
+    }
+    auto &buffer = getThreadTraceBuffer();
+    lock_guard<mutex> lock(buffer.eventsMutex);
+    if (buffer.events.size() < kMaxEventsPerThread) {
+        buffer.events.push_back(TraceEvent {_name, _startNanos, getTraceNanos() - _startNanos});
+    }
+}
+
+} // namespace reone
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+class IOutputStream;
+
+/**
+ * Enables or disables recording of trace zones. Zones are recorded into
+ * per-thread buffers, with nanosecond timestamps.
+ */
+void setTracingEnabled(bool enabled);
+
+bool isTracingEnabled();
+
+/**
+ * Writes recorded trace zones as Chrome trace-event JSON, which can be
+ * inspected in chrome://tracing or Perfetto.
+ */
+void saveTrace(IOutputStream &stream);
+
+/**
+ * Records time spent in the enclosing scope as a trace zone.
+ */
+class TraceZone : boost::noncopyable {
+public:
+    /**
+     * @param name zone name, must outlive saveTrace (normally a string literal)
+     */
+    TraceZone(const char *name);
+    ~TraceZone();
+
+private:
+    const char *_name;
+    int64_t _startNanos {-1};
+};
+
+} // namespace reone
+
+#define R_TRACE_CONCAT_IMPL(a, b) a##b
+#define R_TRACE_CONCAT(a, b) R_TRACE_CONCAT_IMPL(a, b)
+
+/**
+ * Records time spent in the enclosing scope as a trace zone.
+ */
+#define R_TRACE_ZONE(name) reone::TraceZone R_TRACE_CONCAT(traceZone, __LINE__)(name)
@@ -44,6 +44,10 @@ Options OptionsParser::parse() {
         ("game", po::value<string>(), "path to game directory")                                                                    //
         ("dev", po::value<bool>()->default_value(options.game.developer), "enable developer mode")                                 //
         ("neo", po::value<bool>()->default_value(false), "use new game logic (experimental)")                                      //
+        ("scriptprof", po::value<bool>()->default_value(options.game.profileScripts), "profile script execution")                  //
+        ("scriptbudget", po::value<int>()->default_value(options.game.scriptBudget), "script instructions per frame")              //
+        ("simrate", po::value<int>()->default_value(options.game.simRate), "fixed simulation steps per second")                    //
+        ("trace", po::value<bool>()->default_value(options.game.trace), "record Chrome trace of engine zones")                     //
         ("width", po::value<int>()->default_value(options.graphics.width), "window width")                                         //
         ("height", po::value<int>()->default_value(options.graphics.height), "window height")                                      //
         ("fullscreen", po::value<bool>()->default_value(options.graphics.fullscreen), "enable fullscreen")                         //
@@ -82,6 +86,10 @@ Options OptionsParser::parse() {
     options.game.path = vars.count("game") > 0 ? vars["game"].as<string>() : fs::current_path();
     options.game.developer = vars["dev"].as<bool>();
     options.game.neo = vars["neo"].as<bool>();
+    options.game.profileScripts = vars["scriptprof"].as<bool>();
+    options.game.scriptBudget = vars["scriptbudget"].as<int>();
+    options.game.simRate = vars["simrate"].as<int>();
+    options.game.trace = vars["trace"].as<bool>();
     options.graphics.width = vars["width"].as<int>();
     options.graphics.height = vars["height"].as<int>();
     options.graphics.fullscreen = vars["fullscreen"].as<bool>();
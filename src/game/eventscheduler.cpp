@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "eventscheduler.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace game {
+
+static constexpr float kHeartbeatPeriod = 6.0f;
+static constexpr float kPerceptionPeriod = 3.0f;
+
+EventScheduler::EventScheduler() {
+    setPeriod(PeriodicEventType::Heartbeat, kHeartbeatPeriod);
+    setPeriod(PeriodicEventType::Perception, kPerceptionPeriod);
+}
+
+void EventScheduler::add(uint32_t objectId, PeriodicEventType type) {
+    auto &bucket = schedule(type).buckets[bucketIndex(objectId)];
+    if (find(bucket.begin(), bucket.end(), objectId) == bucket.end()) {
+        bucket.push_back(objectId);
+    }
+}
+
+void EventScheduler::remove(uint32_t objectId, PeriodicEventType type) {
+    auto &bucket = schedule(type).buckets[bucketIndex(objectId)];
+    auto it = find(bucket.begin(), bucket.end(), objectId);
+    if (it != bucket.end()) {
+        *it = bucket.back();
+        bucket.pop_back();
+    }
+}
+
+void EventScheduler::clear() {
+    for (auto &schedule : _schedules) {
+        for (auto &bucket : schedule.buckets) {
+            bucket.clear();
+        }
+        schedule.elapsed = 0.0f;
+        schedule.nextBucket = 0;
+        schedule.numFired = 0;
+    }
+    _forced.clear();
+}
+
+void EventScheduler::force(uint32_t objectId, PeriodicEventType type) {
+    _forced.push_back(Event {objectId, type});
+}
+
+void EventScheduler::update(float delta, vector<Event> &due) {
+    for (int i = 0; i < kNumEventTypes; ++i) {
+        auto &schedule = _schedules[i];
+        schedule.numFired = 0;
+        float bucketPeriod = schedule.period / kNumBuckets;
+        schedule.elapsed += delta;
+
+        // Long frames must not fire the same object twice
+        int numBuckets = 0;
+        for (; schedule.elapsed >= bucketPeriod && numBuckets < kNumBuckets; ++numBuckets) {
+            schedule.elapsed -= bucketPeriod;
+            for (auto objectId : schedule.buckets[schedule.nextBucket]) {
+                due.push_back(Event {objectId, static_cast<PeriodicEventType>(i)});
+            }
+            schedule.numFired += static_cast<int>(schedule.buckets[schedule.nextBucket].size());
+            schedule.nextBucket = (schedule.nextBucket + 1) % kNumBuckets;
+        }
+        if (numBuckets == kNumBuckets) {
+            schedule.elapsed = min(schedule.elapsed, bucketPeriod);
+        }
+    }
+    for (auto &event : _forced) {
+        due.push_back(event);
+        ++schedule(event.type).numFired;
+    }
+    _forced.clear();
+}
+
+bool EventScheduler::contains(uint32_t objectId, PeriodicEventType type) const {
+    auto &bucket = schedule(type).buckets[bucketIndex(objectId)];
+    return find(bucket.begin(), bucket.end(), objectId) != bucket.end();
+}
+
+int EventScheduler::numFired(PeriodicEventType type) const {
+    return schedule(type).numFired;
+}
+
+void EventScheduler::setPeriod(PeriodicEventType type, float period) {
+    schedule(type).period = period;
+}
+
+} // namespace game
+
+} // namespace reone
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+namespace game {
+
+enum class PeriodicEventType {
+    Heartbeat,
+    Perception
+};
+
+/**
+ * Fires periodic object events, such as heartbeats and perception ticks.
+ * Objects are distributed between a fixed number of buckets per event type,
+ * and buckets are processed one by one over the event period, so that
+ * objects sharing the same period do not all fire on the same frame.
+ */
+class EventScheduler : boost::noncopyable {
+public:
+    struct Event {
+        uint32_t objectId {0};
+        PeriodicEventType type {PeriodicEventType::Heartbeat};
+    };
+
+    EventScheduler();
+
+    void add(uint32_t objectId, PeriodicEventType type);
+    void remove(uint32_t objectId, PeriodicEventType type);
+    void clear();
+
+    /**
+     * Schedules an event to be fired on the next update, regardless of the
+     * bucket the object is in.
+     */
+    void force(uint32_t objectId, PeriodicEventType type);
+
+    /**
+     * Advances this scheduler by a given amount of seconds, appending due
+     * events to the specified vector.
+     */
+    void update(float delta, std::vector<Event> &due);
+
+    bool contains(uint32_t objectId, PeriodicEventType type) const;
+
+    /**
+     * @return number of events of the specified type fired on the last update
+     */
+    int numFired(PeriodicEventType type) const;
+
+    void setPeriod(PeriodicEventType type, float period);
+
+private:
+    static constexpr int kNumEventTypes = 2;
+    static constexpr int kNumBuckets = 64;
+
+    struct Schedule {
+        float period {0.0f};
+        float elapsed {0.0f}; /**< time since the last bucket was processed */
+        int nextBucket {0};
+        int numFired {0};
+        std::vector<uint32_t> buckets[kNumBuckets];
+    };
+
+    Schedule _schedules[kNumEventTypes];
+    std::vector<Event> _forced;
+
+    Schedule &schedule(PeriodicEventType type) {
+        return _schedules[static_cast<int>(type)];
+    }
+
+    const Schedule &schedule(PeriodicEventType type) const {
+        return _schedules[static_cast<int>(type)];
+    }
+
+    static int bucketIndex(uint32_t objectId) {
+        return static_cast<int>(objectId % kNumBuckets);
+    }
+};
+
+} // namespace game
+
+} // namespace reone
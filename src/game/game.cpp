@@ -18,7 +18,10 @@
 #include "game.h"
 
 #include "../common/collectionutil.h"
+#include "../common/logutil.h"
 #include "../common/pathutil.h"
+#include "../common/stream/fileoutput.h"
+#include "../common/traceutil.h"
 #include "../graphics/aabb.h"
 #include "../graphics/context.h"
 #include "../graphics/meshes.h"
@@ -35,6 +38,8 @@
 #include "../scene/node/camera.h"
 #include "../scene/node/model.h"
 #include "../scene/services.h"
+#include "../script/executioncontext.h"
+#include "../script/scripts.h"
 #include "../script/services.h"
 
 #include "astar.h"
@@ -71,6 +76,10 @@ namespace reone {
 
 namespace game {
 
+static constexpr char kScriptProfileFilename[] = "scriptprofile.csv";
+static constexpr char kTraceFilename[] = "trace.json";
+static constexpr float kMaxSimLag = 0.25f; // at most this much frame time is simulated per frame
+
 static const string kCameraHookNodeName = "camerahook";
 
 void Game::init() {
@@ -111,7 +120,11 @@ void Game::init() {
     _routines = make_unique<Routines>(_id, *this, _services);
     _routines->init();
 
-    _scriptRunner = make_unique<ScriptRunner>(*_routines, _services.script.scripts);
+    if (_options.game.profileScripts) {
+        _scriptProfiler = make_unique<ScriptProfiler>();
+    }
+    _scriptRunner = make_unique<ScriptRunner>(*_routines, _services.script.scripts, _scriptProfiler.get());
+    _scriptRunner->setInstructionBudget(_options.game.scriptBudget);
 
     // Surfaces
 
@@ -152,7 +165,11 @@ void Game::loadModuleNames() {
 }
 
 void Game::run() {
+    if (_options.game.trace) {
+        setTracingEnabled(true);
+    }
     while (!_finished) {
+        R_TRACE_ZONE("Frame");
         _profiler.startFrame();
 
         _profiler.startInput();
@@ -169,6 +186,18 @@ void Game::run() {
 
         _profiler.endFrame();
     }
+
+    if (_scriptProfiler) {
+        auto stream = FileOutputStream(kScriptProfileFilename);
+        _scriptProfiler->save(stream);
+        info("Script profile saved to " + string(kScriptProfileFilename));
+    }
+    if (_options.game.trace) {
+        setTracingEnabled(false);
+        auto stream = FileOutputStream(kTraceFilename);
+        saveTrace(stream);
+        info("Trace saved to " + string(kTraceFilename));
+    }
 }
 
 bool Game::handle(const SDL_Event &e) {
@@ -227,6 +256,8 @@ bool Game::handle(const SDL_Event &e) {
 }
 
 void Game::update() {
+    R_TRACE_ZONE("Game::update");
+
     // Calculate delta time
 
     auto then = _prevFrameTicks;
@@ -253,16 +284,35 @@ void Game::update() {
             auto &area = _module->area();
             auto &pc = _module->pc();
 
+            // Resume suspended scripts
+            _scriptRunner->update();
+
+            // Update simulation
+            if (_options.game.simRate > 0) {
+                float step = 1.0f / _options.game.simRate;
+                _simAccumulator = glm::min(_simAccumulator + delta, kMaxSimLag);
+                while (_simAccumulator >= step) {
+                    pc.savePreviousTransform();
+                    for (auto &object : area.objects()) {
+                        object->savePreviousTransform();
+                    }
+                    updateSimulation(step);
+                    _simAccumulator -= step;
+                }
+                float alpha = _simAccumulator / step;
+                pc.interpolateTransform(alpha);
+                for (auto &object : area.objects()) {
+                    object->interpolateTransform(alpha);
+                }
+            } else {
+                updateSimulation(delta);
+            }
+
             // Update rooms
             for (auto &room : area.rooms()) {
                 room->update(delta);
             }
 
-            // Update game objects
-            for (auto &object : area.objects()) {
-                object->update(delta);
-            }
-
             // Update visibility
             auto pcRoom = pc.room();
             if (pcRoom) {
@@ -296,8 +346,6 @@ void Game::update() {
             _module->area().mainCamera().update(delta);
         }
 
-        _playerController->update(delta);
-
         // Update scene
 
         auto &scene = _services.scene.graphs.get(kSceneMain);
@@ -332,7 +380,64 @@ void Game::update() {
     }
 }
 
+void Game::updateSimulation(float delta) {
+    R_TRACE_ZONE("Game::updateSimulation");
+
+    // Update game objects
+    for (auto &object : _module->area().objects()) {
+        object->update(delta);
+    }
+
+    updateDelayedCommands(delta);
+    updatePeriodicEvents(delta);
+
+    _playerController->update(delta);
+
+    updateMovement();
+}
+
+void Game::updateMovement() {
+    R_TRACE_ZONE("Game::updateMovement");
+
+    _movingCreatures.clear();
+    _elevationProbes.clear();
+
+    auto &pc = _module->pc();
+    if (pc.isMoveRequested()) {
+        _movingCreatures.push_back(&pc);
+    }
+    for (auto &object : _module->area().objects()) {
+        if (object == &pc || object->type() != ObjectType::Creature) {
+            continue;
+        }
+        auto creature = static_cast<Creature *>(object);
+        if (creature->isMoveRequested()) {
+            _movingCreatures.push_back(creature);
+        }
+    }
+    if (_movingCreatures.empty()) {
+        return;
+    }
+    for (auto &creature : _movingCreatures) {
+        _elevationProbes.push_back(creature->requestedPosition());
+    }
+
+    // Test elevations of all moving creatures at once
+    auto &scene = _services.scene.graphs.get(kSceneMain);
+    scene.testElevations(_elevationProbes, _elevationResults, _elevationCollisions);
+
+    for (size_t i = 0; i < _movingCreatures.size(); ++i) {
+        if (_elevationResults[i]) {
+            _movingCreatures[i]->finishMove(_elevationCollisions[i].intersection.z);
+        } else {
+            _movingCreatures[i]->cancelMove();
+        }
+    }
+}
+
 void Game::render() {
+    R_TRACE_ZONE("Game::render");
+
     _services.graphics.context.clearColorDepth();
 
     if (_stage == Stage::MovieLegal) {
@@ -371,12 +476,35 @@ void Game::render() {
     _services.graphics.window.swapBuffers();
 }
 
+static void collectScripts(const Gff &gff, set<string> &resRefs) {
+    for (auto &field : gff.fields()) {
+        if (field.type != Gff::FieldType::ResRef || field.strValue.empty()) {
+            continue;
+        }
+        if (boost::starts_with(field.label, "Script") ||
+            boost::starts_with(field.label, "On") ||
+            boost::starts_with(field.label, "Mod_On")) {
+            resRefs.insert(field.strValue);
+        }
+    }
+}
+
 void Game::loadModule(const string &name) {
+    R_TRACE_ZONE("Game::loadModule");
+
     _services.game.resourceLayout.loadModuleResources(name);
+    precompileModuleScripts();
+
+    _delayedCommands.clear();
+    _eventScheduler.clear();
+    _scriptRunner->clear();
 
     auto &scene = _services.scene.graphs.get(kSceneMain);
     scene.clear();
 
+    _objectGrid.clear();
+    _objectTagIndex.clear();
+
     auto &module = static_cast<Module &>(*newModule());
     module.setSceneGraph(&scene);
     module.load(name);
@@ -441,11 +569,16 @@ void Game::loadModule(const string &name) {
                 scene.addRoot(*walkmeshOpen2);
             }
         }
+        addHeartbeat(*object);
+        _objectGrid.add(*object);
+        _objectTagIndex.add(*object);
     }
 
     // Player character
 
     auto &pc = module.pc();
+    _objectGrid.add(pc);
+    _objectTagIndex.add(pc);
 
     auto pcModel = static_cast<ModelSceneNode *>(pc.sceneNode());
     scene.addRoot(*pcModel);
@@ -459,6 +592,17 @@ void Game::loadModule(const string &name) {
 
     _selectionController->setPC(&pc);
 
+    // Simulation
+
+    _simAccumulator = 0.0f;
+    pc.savePreviousTransform();
+    for (auto &object : module.area().objects()) {
+        object->savePreviousTransform();
+    }
+
+    addHeartbeat(pc);
+    addHeartbeat(module);
+
     // Path
 
     auto path = module.area().path();
@@ -508,73 +652,142 @@ void Game::changeCursor(CursorType type) {
 }
 
 void Game::runScript(const string &name, Object &caller, Object *triggerrer) {
-    _scriptRunner->run(name, caller.id(), triggerrer ? triggerrer->id() : kObjectInvalid);
+    _scriptRunner->runSliced(name, caller.id(), triggerrer ? triggerrer->id() : kObjectInvalid);
 }
 
-Object *Game::objectById(uint32_t id) {
-    if (id == kObjectSelf || id == kObjectInvalid) {
-        return nullptr;
-    }
-    auto object = getFromLookupOrNull(_objects, id);
-    return object.get();
+void Game::delayCommand(uint32_t callerId, shared_ptr<ExecutionContext> action, float seconds) {
+    DelayedCommand command;
+    command.callerId = callerId;
+    command.action = move(action);
+    _delayedCommands.schedule(seconds, move(command));
 }
 
-Object *Game::objectByTag(const string &tag, int nth) {
-    if (!_module) {
-        return nullptr;
+void Game::precompileModuleScripts() {
+    static const vector<pair<string, ResourceType>> kTemplateLists {
+        {"Creature List", ResourceType::Utc},
+        {"Placeable List", ResourceType::Utp},
+        {"Door List", ResourceType::Utd},
+        {"TriggerList", ResourceType::Utt}};
+
+    auto ifo = _services.resource.gffs.get("module", ResourceType::Ifo);
+    if (!ifo) {
+        return;
     }
-    int match = 0;
-    for (auto object : _module->area().objects()) {
-        if (object->tag() != tag) {
-            continue;
-        }
-        if (match++ == nth) {
-            return object;
+    auto resRefs = set<string>();
+    collectScripts(*ifo, resRefs);
+
+    auto entryArea = ifo->getString("Mod_Entry_Area");
+    auto are = _services.resource.gffs.get(entryArea, ResourceType::Are);
+    if (are) {
+        collectScripts(*are, resRefs);
+    }
+    auto git = _services.resource.gffs.get(entryArea, ResourceType::Git);
+    if (git) {
+        for (auto &templateList : kTemplateLists) {
+            for (auto &gitObject : git->getList(templateList.first)) {
+                auto templateResRef = gitObject->getString("TemplateResRef");
+                auto tmplt = _services.resource.gffs.get(templateResRef, templateList.second);
+                if (tmplt) {
+                    collectScripts(*tmplt, resRefs);
+                }
+            }
         }
     }
-    auto &pc = _module->pc();
-    if (pc.tag() == tag) {
-        return &pc;
+
+    _services.script.scripts.precompile(resRefs);
+}
+
+void Game::updateDelayedCommands(float delta) {
+    _delayedCommands.advance(delta, _expiredCommands);
+
+    // Actions may schedule further commands, which will expire no sooner than on the next tick
+    for (auto &command : _expiredCommands) {
+        if (!objectById(command.callerId)) {
+            continue;
+        }
+        _scriptRunner->runAction(*command.action, command.callerId);
     }
-    return nullptr;
+    _expiredCommands.clear();
 }
 
-set<Object *> Game::objectsInRadius(const glm::vec2 &origin, float radius, int typeMask) {
-    if (!_module) {
-        return set<Object *>();
+void Game::forceHeartbeat(uint32_t objectId) {
+    _eventScheduler.force(objectId, PeriodicEventType::Heartbeat);
+}
+
+void Game::removeHeartbeat(uint32_t objectId) {
+    _eventScheduler.remove(objectId, PeriodicEventType::Heartbeat);
+}
+
+void Game::addHeartbeat(Object &object) {
+    if (!object.scriptOnHeartbeat().empty()) {
+        _eventScheduler.add(object.id(), PeriodicEventType::Heartbeat);
     }
-    auto objects = set<Object *>();
-    float radius2 = radius * radius;
-    for (auto object : _module->area().objects()) {
-        if ((typeMask & static_cast<int>(object->type())) == 0) {
+}
+
+void Game::updatePeriodicEvents(float delta) {
+    _eventScheduler.update(delta, _dueEvents);
+
+    for (auto &event : _dueEvents) {
+        auto object = objectById(event.objectId);
+        if (!object) {
             continue;
         }
-        if (object->square2dDistanceTo(origin) < radius2) {
-            objects.insert(object);
+        if (event.type == PeriodicEventType::Heartbeat && !object->scriptOnHeartbeat().empty()) {
+            runScript(object->scriptOnHeartbeat(), *object);
         }
     }
-    auto &pc = _module->pc();
-    if ((typeMask & static_cast<int>(ObjectType::Creature)) != 0 && pc.square2dDistanceTo(origin) < radius2) {
-        objects.insert(&pc);
+    _dueEvents.clear();
+}
+
+Object *Game::objectById(uint32_t id) {
+    if (id == kObjectSelf || id == kObjectInvalid) {
+        return nullptr;
     }
-    return objects;
+    auto object = getFromLookupOrNull(_objects, id);
+    return object.get();
 }
 
-std::set<Object *> Game::objectsSatisfying(std::function<bool(const Object &)> pred) {
+Object *Game::objectByTag(const string &tag, int nth) {
+    return _objectTagIndex.get(tag, nth);
+}
+
+void Game::objectsInRadius(const glm::vec2 &origin, float radius, vector<Object *> &outObjects, int typeMask) {
+    outObjects.clear();
     if (!_module) {
-        return set<Object *>();
+        return;
+    }
+    _objectGrid.objectsInRadius(origin, radius, typeMask, outObjects);
+}
+
+void Game::objectsSatisfying(function<bool(const Object &)> pred, vector<Object *> &outObjects) {
+    outObjects.clear();
+    if (!_module) {
+        return;
     }
-    auto objects = set<Object *>();
     for (auto object : _module->area().objects()) {
         if (pred(*object)) {
-            objects.insert(object);
+            outObjects.push_back(object);
         }
     }
     auto &pc = _module->pc();
     if (pred(pc)) {
-        objects.insert(&pc);
+        outObjects.push_back(&pc);
+    }
+}
+
+Object *Game::nearestObject(const glm::vec2 &origin, int nth, function<bool(const Object &)> pred) {
+    if (!_module) {
+        return nullptr;
     }
-    return objects;
+    return _objectGrid.nearestObject(origin, nth, pred);
+}
+
+void Game::onObjectMoved(Object &object) {
+    _objectGrid.update(object);
+}
+
+void Game::onObjectTagChanged(Object &object, const string &oldTag) {
+    _objectTagIndex.update(object, oldTag);
 }
 
 // END IGame
@@ -638,6 +851,7 @@ shared_ptr<Object> Game::newWaypoint() {
 // IEventHandler
 
 void Game::handleInput() {
+    R_TRACE_ZONE("Game::handleInput");
     _services.graphics.window.processEvents(_finished);
 }
 
@@ -17,10 +17,14 @@
 
 #pragma once
 
+#include "../common/timerwheel.h"
 #include "../graphics/cursor.h"
 #include "../graphics/eventhandler.h"
 #include "../movie/movie.h"
+#include "../scene/collision.h"
+#include "../script/profiler.h"
 
+#include "eventscheduler.h"
 #include "gameinterface.h"
 #include "gui/console.h"
 #include "gui/dialog.h"
@@ -30,6 +34,8 @@
 #include "location.h"
 #include "object/factory.h"
 #include "object/module.h"
+#include "objectgrid.h"
+#include "objecttagindex.h"
 #include "options.h"
 #include "profiler.h"
 #include "script/routines.h"
@@ -54,6 +60,12 @@ struct GraphicsServices;
 
 } // namespace graphics
 
+namespace script {
+
+struct ExecutionContext;
+
+}
+
 namespace game {
 
 class Creature;
@@ -106,6 +118,30 @@ public:
 
     // END Global variables
 
+    // Scripts
+
+    /**
+     * Schedules an action to be executed on behalf of the specified caller
+     * after a given amount of seconds.
+     */
+    void delayCommand(uint32_t callerId, std::shared_ptr<script::ExecutionContext> action, float seconds);
+
+    /**
+     * Runs OnHeartbeat script of the specified object on the next frame.
+     */
+    void forceHeartbeat(uint32_t objectId);
+
+    /**
+     * Stops running OnHeartbeat script of the specified object.
+     */
+    void removeHeartbeat(uint32_t objectId);
+
+    const EventScheduler &eventScheduler() const {
+        return _eventScheduler;
+    }
+
+    // END Scripts
+
     // IGame
 
     void startNewGame() override;
@@ -120,8 +156,12 @@ public:
 
     Object *objectById(uint32_t id) override;
     Object *objectByTag(const std::string &tag, int nth = 0) override;
-    std::set<Object *> objectsInRadius(const glm::vec2 &origin, float radius, int typeMask = static_cast<int>(ObjectType::All)) override;
-    std::set<Object *> objectsSatisfying(std::function<bool(const Object &)> pred) override;
+    void objectsInRadius(const glm::vec2 &origin, float radius, std::vector<Object *> &outObjects, int typeMask = static_cast<int>(ObjectType::All)) override;
+    void objectsSatisfying(std::function<bool(const Object &)> pred, std::vector<Object *> &outObjects) override;
+    Object *nearestObject(const glm::vec2 &origin, int nth, std::function<bool(const Object &)> pred) override;
+
+    void onObjectMoved(Object &object) override;
+    void onObjectTagChanged(Object &object, const std::string &oldTag) override;
 
     const std::set<std::string> &moduleNames() const override {
         return _moduleNames;
@@ -189,6 +229,11 @@ protected:
         // END Controls
     };
 
+    struct DelayedCommand {
+        uint32_t callerId {script::kObjectInvalid};
+        std::shared_ptr<script::ExecutionContext> action;
+    };
+
     class WorldRenderer : boost::noncopyable {
     public:
         WorldRenderer(
@@ -216,6 +261,7 @@ protected:
     uint32_t _prevFrameTicks {0};
     float _deltaMultiplier {1.0f};
     uint32_t _objectIdCounter {2}; // 0 is self, 1 is invalid
+    float _simAccumulator {0.0f};  /**< simulation time not yet consumed by fixed steps */
 
     Stage _stage {Stage::MovieLegal};
 
@@ -242,6 +288,13 @@ protected:
     std::map<uint32_t, std::shared_ptr<Object>> _objects;
 
     Module *_module {nullptr};
+    ObjectGrid _objectGrid;
+    ObjectTagIndex _objectTagIndex;
+
+    std::vector<Creature *> _movingCreatures;
+    std::vector<glm::vec2> _elevationProbes;
+    std::vector<bool> _elevationResults;
+    std::vector<scene::Collision> _elevationCollisions;
 
     // END Objects
 
@@ -264,6 +317,16 @@ protected:
 
     // END Global variables
 
+    // Scripts
+
+    TimerWheel<DelayedCommand> _delayedCommands;
+    std::vector<DelayedCommand> _expiredCommands;
+
+    EventScheduler _eventScheduler;
+    std::vector<EventScheduler::Event> _dueEvents;
+
+    // END Scripts
+
     // Cursor
 
     graphics::Cursor *_cursor {nullptr};
@@ -274,6 +337,7 @@ protected:
     // Profiling
 
     Profiler _profiler;
+    std::unique_ptr<script::ScriptProfiler> _scriptProfiler;
 
     // END Profiling
 
@@ -281,10 +345,20 @@ protected:
     void update();
     void render();
 
+    void updateSimulation(float delta);
+    void updateMovement();
+
     void loadModuleNames();
 
     void loadModule(const std::string &name);
 
+    void precompileModuleScripts();
+
+    void updateDelayedCommands(float delta);
+    void updatePeriodicEvents(float delta);
+
+    void addHeartbeat(Object &object);
+
     template <class T>
     inline std::shared_ptr<Object> newObject() {
         auto object = std::make_shared<T>(
@@ -45,8 +45,25 @@ public:
 
     virtual Object *objectById(uint32_t id) = 0;
     virtual Object *objectByTag(const std::string &tag, int nth = 0) = 0;
-    virtual std::set<Object *> objectsInRadius(const glm::vec2 &origin, float radius, int typeMask = static_cast<int>(ObjectType::All)) = 0;
-    virtual std::set<Object *> objectsSatisfying(std::function<bool(const Object &)> pred) = 0;
+
+    /**
+     * Replaces contents of outObjects with objects of matching type, whose 2D distance to origin is less than radius.
+     */
+    virtual void objectsInRadius(const glm::vec2 &origin, float radius, std::vector<Object *> &outObjects, int typeMask = static_cast<int>(ObjectType::All)) = 0;
+
+    /**
+     * Replaces contents of outObjects with objects, that satisfy predicate.
+     */
+    virtual void objectsSatisfying(std::function<bool(const Object &)> pred, std::vector<Object *> &outObjects) = 0;
+
+    /**
+     * @param nth zero-based index of object, ordered by 2D distance to origin
+     * @return nth nearest object, that satisfies predicate, or nullptr if not found
+     */
+    virtual Object *nearestObject(const glm::vec2 &origin, int nth, std::function<bool(const Object &)> pred) = 0;
+
+    virtual void onObjectMoved(Object &object) = 0;
+    virtual void onObjectTagChanged(Object &object, const std::string &oldTag) = 0;
 
     virtual const std::set<std::string> &moduleNames() const = 0;
 };
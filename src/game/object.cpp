@@ -21,6 +21,7 @@
 #include "../graphics/window.h"
 #include "../scene/graph.h"
 
+#include "gameinterface.h"
 #include "options.h"
 
 namespace reone {
@@ -38,6 +39,21 @@ void Object::update(float delta) {
     }
 }
 
+void Object::setPosition(glm::vec3 position) {
+    _position = std::move(position);
+    flushTransform();
+    _game.onObjectMoved(*this);
+}
+
+void Object::setTag(std::string tag) {
+    if (_tag == tag) {
+        return;
+    }
+    auto oldTag = std::move(_tag);
+    _tag = std::move(tag);
+    _game.onObjectTagChanged(*this, oldTag);
+}
+
 void Object::face(Object &other) {
     face(glm::vec2(other._position));
 }
@@ -61,6 +77,39 @@ void Object::hide() {
     _sceneNode->setEnabled(false);
 }
 
+void Object::interpolateTransform(float alpha) {
+    if (!_sceneNode) {
+        return;
+    }
+
+    // Skip objects that did not move during the last simulation step, but
+    // make sure the blend from the step before is replaced by the final transform
+    if (_prevPosition == _position && _prevFacing == _facing) {
+        if (_transformInterpolated) {
+            _sceneNode->setLocalTransform(getTransform(_position, _facing));
+            _transformInterpolated = false;
+        }
+        return;
+    }
+
+    auto position = glm::mix(_prevPosition, _position, alpha);
+
+    // Interpolate facing along the shortest arc
+    float facingDelta = _facing - _prevFacing;
+    facingDelta = glm::atan(glm::sin(facingDelta), glm::cos(facingDelta));
+    float facing = _prevFacing + alpha * facingDelta;
+
+    _sceneNode->setLocalTransform(getTransform(position, facing));
+    _transformInterpolated = true;
+}
+
+glm::mat4 Object::getTransform(const glm::vec3 &position, float facing) const {
+    auto transform = glm::translate(position);
+    transform *= glm::rotate(facing, glm::vec3(0.0f, 0.0f, 1.0f));
+    transform *= glm::rotate(_pitch, glm::vec3(1.0f, 0.0f, 0.0f));
+    return transform;
+}
+
 glm::vec3 Object::targetWorldCoords() const {
     if (!_sceneNode) {
         return _position;
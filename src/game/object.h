@@ -121,14 +121,9 @@ public:
 
     glm::ivec3 targetScreenCoords() const;
 
-    void setTag(std::string tag) {
-        _tag = std::move(tag);
-    }
+    void setTag(std::string tag);
 
-    void setPosition(glm::vec3 position) {
-        _position = std::move(position);
-        flushTransform();
-    }
+    void setPosition(glm::vec3 position);
 
     void setFacing(float facing) {
         _facing = facing;
@@ -209,6 +204,35 @@ public:
 
     // END Local variables
 
+    // Scripts
+
+    const std::string &scriptOnHeartbeat() const {
+        return _scriptOnHeartbeat;
+    }
+
+    // END Scripts
+
+    // Interpolation
+
+    /**
+     * Saves current position and facing as the start of transform
+     * interpolation. Called before every fixed simulation step.
+     */
+    void savePreviousTransform() {
+        _prevPosition = _position;
+        _prevFacing = _facing;
+    }
+
+    /**
+     * Sets scene node transform to a blend of previous and current
+     * simulation states.
+     *
+     * @param alpha blend factor, where 0 is previous and 1 is current state
+     */
+    void interpolateTransform(float alpha);
+
+    // END Interpolation
+
 protected:
     uint32_t _id;
     ObjectType _type;
@@ -241,6 +265,20 @@ protected:
 
     // END Local variables
 
+    // Scripts
+
+    std::string _scriptOnHeartbeat;
+
+    // END Scripts
+
+    // Interpolation
+
+    glm::vec3 _prevPosition {0.0f};
+    float _prevFacing {0.0f};
+    bool _transformInterpolated {false}; /**< scene node transform is a blend of simulation states */
+
+    // END Interpolation
+
     Object(
         uint32_t id,
         ObjectType type,
@@ -264,11 +302,13 @@ protected:
         if (!_sceneNode) {
             return;
         }
-        auto transform = glm::translate(_position);
-        transform *= glm::rotate(_facing, glm::vec3(0.0f, 0.0f, 1.0f));
-        transform *= glm::rotate(_pitch, glm::vec3(1.0f, 0.0f, 0.0f));
-        _sceneNode->setLocalTransform(std::move(transform));
+        _sceneNode->setLocalTransform(getTransform(_position, _facing));
     }
+
+    /**
+     * @return local transform of an object at the specified position and facing, with the current pitch
+     */
+    glm::mat4 getTransform(const glm::vec3 &position, float facing) const;
 };
 
 } // namespace game
@@ -26,7 +26,6 @@
 #include "../../resource/gffs.h"
 #include "../../resource/services.h"
 #include "../../resource/strings.h"
-#include "../../scene/collision.h"
 #include "../../scene/graph.h"
 #include "../../scene/node/model.h"
 
@@ -82,6 +81,7 @@ void Creature::loadFromUtc(const string &templateResRef) {
     auto conversation = utc->getString("Conversation");
     auto bodyVariation = utc->getInt("BodyVariation", 1);
     auto textureVar = utc->getInt("TextureVar", 1);
+    auto scriptHeartbeat = utc->getString("ScriptHeartbeat");
 
     auto itemList = utc->getList("ItemList");
     for (auto &utcItem : itemList) {
@@ -203,6 +203,7 @@ void Creature::loadFromUtc(const string &templateResRef) {
 
     _tag = move(tag);
     _name = move(firstName);
+    _scriptOnHeartbeat = move(scriptHeartbeat);
     _conversation = move(conversation);
     _modelType = static_cast<ModelType>(modelType[0]);
     _sceneNode = sceneNode.get();
@@ -260,18 +261,16 @@ bool Creature::moveTo(const glm::vec2 &destination, bool run, float range, float
     return false;
 }
 
-bool Creature::moveForward(float delta) {
+void Creature::moveForward(float delta) {
     auto dir = glm::vec2(-glm::sin(_facing), glm::cos(_facing));
-    auto newPosition = glm::vec2(_position) + delta * kCreatureRunSpeed * dir;
-
-    Collision collision;
-    if (!_sceneGraph->testElevation(glm::vec2(newPosition), collision)) {
-        return false;
-    }
+    auto start = _moveRequested ? _requestedPosition : glm::vec2(_position);
+    _requestedPosition = start + delta * kCreatureRunSpeed * dir;
+    _moveRequested = true;
+}
 
-    _position = glm::vec3(newPosition, collision.intersection.z);
-    flushTransform();
-    return true;
+void Creature::finishMove(float elevation) {
+    _moveRequested = false;
+    setPosition(glm::vec3(_requestedPosition, elevation));
 }
 
 void Creature::update(float delta) {
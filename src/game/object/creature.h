@@ -71,7 +71,30 @@ public:
      */
     virtual bool moveTo(const glm::vec2 &destination, bool run, float range, float delta);
 
-    bool moveForward(float delta);
+    /**
+     * Requests creature to move forward. Requested position is tested for
+     * elevation by the game, together with positions of other moving creatures.
+     */
+    void moveForward(float delta);
+
+    /**
+     * Completes movement, requested by moveForward.
+     *
+     * @param elevation elevation at the requested position
+     */
+    void finishMove(float elevation);
+
+    void cancelMove() {
+        _moveRequested = false;
+    }
+
+    bool isMoveRequested() const {
+        return _moveRequested;
+    }
+
+    const glm::vec2 &requestedPosition() const {
+        return _requestedPosition;
+    }
 
     void setState(State state) {
         _state = state;
@@ -112,6 +135,9 @@ private:
 
     State _state {State::Pause};
 
+    bool _moveRequested {false};
+    glm::vec2 _requestedPosition {0.0f};
+
     ModelType _modelType {ModelType::FullBody};
     std::string _conversation;
 
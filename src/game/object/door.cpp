@@ -59,6 +59,7 @@ void Door::loadFromGit(const Gff &git) {
     }
     auto genericType = utd->getInt("GenericType");
     auto locName = _resourceSvc.strings.get(utd->getInt("LocName"));
+    auto onHeartbeat = utd->getString("OnHeartbeat");
 
     // From doortypes 2DA
 
@@ -106,6 +107,7 @@ void Door::loadFromGit(const Gff &git) {
 
     _tag = move(tag);
     _name = move(locName);
+    _scriptOnHeartbeat = move(onHeartbeat);
     _position = glm::vec3(x, y, z);
     _facing = bearing;
     _sceneNode = sceneNode.get();
@@ -149,9 +151,7 @@ void Door::update(float delta) {
 void Door::flushTransform() {
     Object::flushTransform();
 
-    auto transform = glm::translate(_position);
-    transform *= glm::rotate(_facing, glm::vec3(0.0f, 0.0f, 1.0f));
-    transform *= glm::rotate(_pitch, glm::vec3(1.0f, 0.0f, 0.0f));
+    auto transform = getTransform(_position, _facing);
 
     if (_walkmeshClosed) {
         _walkmeshClosed->setLocalTransform(transform);
@@ -57,6 +57,7 @@ void Module::load(const string &name) {
     auto entryZ = ifo->getFloat("Mod_Entry_Z");
     auto entryDirX = ifo->getFloat("Mod_Entry_Dir_X");
     auto entryDirY = ifo->getFloat("Mod_Entry_Dir_Y");
+    auto onHeartbeat = ifo->getString("Mod_OnHeartbeat");
 
     // Make player character
 
@@ -73,6 +74,8 @@ void Module::load(const string &name) {
     area.setSceneGraph(_sceneGraph);
     area.load(entryArea);
     _area = &area;
+
+    _scriptOnHeartbeat = move(onHeartbeat);
 }
 
 } // namespace game
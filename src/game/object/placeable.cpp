@@ -63,6 +63,7 @@ void Placeable::loadFromGit(const Gff &git) {
     auto tag = utp->getString("Tag");
     auto locName = _resourceSvc.strings.get(utp->getInt("LocName"));
     auto appearance = utp->getInt("Appearance");
+    auto onHeartbeat = utp->getString("OnHeartbeat");
 
     auto hasInventory = utp->getBool("HasInventory");
     if (hasInventory) {
@@ -107,6 +108,7 @@ void Placeable::loadFromGit(const Gff &git) {
 
     _tag = move(tag);
     _name = move(locName);
+    _scriptOnHeartbeat = move(onHeartbeat);
     _position = glm::vec3(x, y, z);
     _facing = bearing;
     _sceneNode = sceneNode.get();
@@ -118,10 +120,6 @@ void Placeable::loadFromGit(const Gff &git) {
 void Placeable::flushTransform() {
     Object::flushTransform();
 
-    auto transform = glm::translate(_position);
-    transform *= glm::rotate(_facing, glm::vec3(0.0f, 0.0f, 1.0f));
-    transform *= glm::rotate(_pitch, glm::vec3(1.0f, 0.0f, 0.0f));
-
     if (_walkmesh) {
         _walkmesh->setLocalTransform(_sceneNode->localTransform());
     }
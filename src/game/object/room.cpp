@@ -72,13 +72,14 @@ void Room::loadFromLyt(const Layout::Room &lyt, GrassProperties grassProperties)
 void Room::update(float delta) {
     if (_walkmesh) {
         auto &walkmesh = _walkmesh->walkmesh();
-        auto objectsInside = _game.objectsSatisfying([&walkmesh](auto &object) {
-            return walkmesh.contains(glm::vec2(object.position()));
-        });
-        for (auto &object : objectsInside) {
+        _game.objectsSatisfying(
+            [&walkmesh](auto &object) {
+                return walkmesh.contains(glm::vec2(object.position()));
+            },
+            _objectsInside);
+        for (auto &object : _objectsInside) {
             object->setRoom(this);
         }
-        _objectsInside.swap(objectsInside);
     }
 }
 
@@ -106,9 +107,7 @@ void Room::flushTransform() {
     if (!_sceneNode) {
         return;
     }
-    auto transform = glm::translate(_position);
-    transform *= glm::rotate(_facing, glm::vec3(0.0f, 0.0f, 1.0f));
-    transform *= glm::rotate(_pitch, glm::vec3(1.0f, 0.0f, 0.0f));
+    auto transform = getTransform(_position, _facing);
 
     _sceneNode->setLocalTransform(transform);
 
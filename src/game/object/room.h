@@ -67,7 +67,7 @@ public:
         return _grass;
     }
 
-    const std::set<Object *> &objectsInside() const {
+    const std::vector<Object *> &objectsInside() const {
         return _objectsInside;
     }
 
@@ -78,7 +78,7 @@ private:
     scene::WalkmeshSceneNode *_walkmesh {nullptr};
     scene::GrassSceneNode *_grass {nullptr};
 
-    std::set<Object *> _objectsInside;
+    std::vector<Object *> _objectsInside;
 
     void flushTransform() override;
 };
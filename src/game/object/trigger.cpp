@@ -57,6 +57,7 @@ void Trigger::loadFromGit(const Gff &git) {
     auto tag = utt->getString("Tag");
     auto scriptOnEnter = utt->getString("ScriptOnEnter");
     auto scriptOnExit = utt->getString("ScriptOnExit");
+    auto scriptHeartbeat = utt->getString("ScriptHeartbeat");
 
     // Make scene node
     if (_geometry.size() >= 3ll) {
@@ -72,6 +73,7 @@ void Trigger::loadFromGit(const Gff &git) {
 
     _scriptOnEnter = move(scriptOnEnter);
     _scriptOnExit = move(scriptOnExit);
+    _scriptOnHeartbeat = move(scriptHeartbeat);
 
     //
 
@@ -89,12 +91,13 @@ void Trigger::update(float delta) {
 
     auto sceneNode = static_cast<TriggerSceneNode *>(_sceneNode);
     auto aabbSize = sceneNode->aabb().size();
-    auto objectsInRadius = _game.objectsInRadius(
+    _game.objectsInRadius(
         glm::vec2(sceneNode->getWorldCenterOfAABB()),
         0.5f * glm::max(aabbSize.x, aabbSize.y),
+        _objectsInRadius,
         static_cast<int>(ObjectType::Creature));
 
-    for (auto &object : objectsInRadius) {
+    for (auto &object : _objectsInRadius) {
         if (!sceneNode->isIn(glm::vec2(object->position()))) {
             continue;
         }
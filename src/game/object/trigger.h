@@ -58,6 +58,7 @@ private:
     std::vector<glm::vec3> _geometry;
 
     std::set<Object *> _objectsInside;
+    std::vector<Object *> _objectsInRadius;
 
     // Scripts
 
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "objectgrid.h"
+
+#include "object.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace game {
+
+void ObjectGrid::add(Object &object) {
+    if (_objectCells.count(&object) > 0) {
+        return;
+    }
+    addToCell(object, getCell(glm::vec2(object.position())));
+}
+
+void ObjectGrid::remove(Object &object) {
+    auto it = _objectCells.find(&object);
+    if (it == _objectCells.end()) {
+        return;
+    }
+    removeFromCell(object, it->second);
+    _objectCells.erase(it);
+}
+
+void ObjectGrid::update(Object &object) {
+    auto it = _objectCells.find(&object);
+    if (it == _objectCells.end()) {
+        return;
+    }
+    auto cell = getCell(glm::vec2(object.position()));
+    if (getCellKey(cell) == it->second) {
+        return;
+    }
+    removeFromCell(object, it->second);
+    addToCell(object, cell);
+}
+
+void ObjectGrid::clear() {
+    _cells.clear();
+    _objectCells.clear();
+    _minCell = glm::ivec2(0);
+    _maxCell = glm::ivec2(0);
+}
+
+void ObjectGrid::objectsInRadius(const glm::vec2 &origin, float radius, int typeMask, vector<Object *> &outObjects) const {
+    if (_objectCells.empty()) {
+        return;
+    }
+    auto minCell = glm::max(getCell(origin - radius), _minCell);
+    auto maxCell = glm::min(getCell(origin + radius), _maxCell);
+    float radius2 = radius * radius;
+    for (int y = minCell.y; y <= maxCell.y; ++y) {
+        for (int x = minCell.x; x <= maxCell.x; ++x) {
+            auto it = _cells.find(getCellKey(glm::ivec2(x, y)));
+            if (it == _cells.end()) {
+                continue;
+            }
+            for (auto &object : it->second) {
+                if ((typeMask & static_cast<int>(object->type())) == 0) {
+                    continue;
+                }
+                if (object->square2dDistanceTo(origin) < radius2) {
+                    outObjects.push_back(object);
+                }
+            }
+        }
+    }
+}
+
+Object *ObjectGrid::nearestObject(const glm::vec2 &origin, int nth, const function<bool(const Object &)> &pred) const {
+    if (_objectCells.empty() || nth < 0) {
+        return nullptr;
+    }
+    auto center = getCell(origin);
+    auto toMin = glm::abs(center - _minCell);
+    auto toMax = glm::abs(_maxCell - center);
+    int maxRing = glm::max(glm::max(toMin.x, toMin.y), glm::max(toMax.x, toMax.y));
+
+    auto candidates = vector<pair<float, Object *>>();
+    auto visitCell = [this, &origin, &pred, &candidates](int x, int y) {
+        auto it = _cells.find(getCellKey(glm::ivec2(x, y)));
+        if (it == _cells.end()) {
+            return;
+        }
+        for (auto &object : it->second) {
+            if (pred(*object)) {
+                candidates.push_back(make_pair(object->square2dDistanceTo(origin), object));
+            }
+        }
+    };
+    auto nthCandidate = [&candidates, &nth]() -> pair<float, Object *> & {
+        nth_element(candidates.begin(), candidates.begin() + nth, candidates.end());
+        return candidates[nth];
+    };
+
+    // Visit rings of cells around the origin, until nth nearest object is known
+    for (int ring = 0; ring <= maxRing; ++ring) {
+        if (ring == 0) {
+            visitCell(center.x, center.y);
+        } else {
+            for (int x = center.x - ring; x <= center.x + ring; ++x) {
+                visitCell(x, center.y - ring);
+                visitCell(x, center.y + ring);
+            }
+            for (int y = center.y - ring + 1; y <= center.y + ring - 1; ++y) {
+                visitCell(center.x - ring, y);
+                visitCell(center.x + ring, y);
+            }
+        }
+        if (candidates.size() <= static_cast<size_t>(nth)) {
+            continue;
+        }
+        // Objects in unvisited cells are at least this far from the origin
+        float reach = ring * _cellSize;
+        auto &candidate = nthCandidate();
+        if (candidate.first <= reach * reach) {
+            return candidate.second;
+        }
+    }
+    if (candidates.size() <= static_cast<size_t>(nth)) {
+        return nullptr;
+    }
+
+    return nthCandidate().second;
+}
+
+glm::ivec2 ObjectGrid::getCell(const glm::vec2 &position) const {
+    return glm::ivec2(glm::floor(position / _cellSize));
+}
+
+void ObjectGrid::addToCell(Object &object, const glm::ivec2 &cell) {
+    if (_objectCells.empty()) {
+        _minCell = cell;
+        _maxCell = cell;
+    } else {
+        _minCell = glm::min(_minCell, cell);
+        _maxCell = glm::max(_maxCell, cell);
+    }
+    uint64_t key = getCellKey(cell);
+    _cells[key].push_back(&object);
+    _objectCells[&object] = key;
+}
+
+void ObjectGrid::removeFromCell(Object &object, uint64_t key) {
+    auto it = _cells.find(key);
+    if (it == _cells.end()) {
+        return;
+    }
+    auto &objects = it->second;
+    auto objIt = find(objects.begin(), objects.end(), &object);
+    if (objIt != objects.end()) {
+        *objIt = objects.back();
+        objects.pop_back();
+    }
+    if (objects.empty()) {
+        _cells.erase(it);
+    }
+}
+
+uint64_t ObjectGrid::getCellKey(const glm::ivec2 &cell) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(cell.x)) << 32) | static_cast<uint32_t>(cell.y);
+}
+
+} // namespace game
+
+} // namespace reone
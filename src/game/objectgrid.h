@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "types.h"
+
+namespace reone {
+
+namespace game {
+
+const float kObjectGridCellSize = 8.0f;
+
+class Object;
+
+/**
+ * Uniform grid of objects, bucketed by their 2D position. Radius and nearest
+ * object queries only visit cells around the origin. Grid must be updated
+ * whenever an object changes position.
+ */
+class ObjectGrid : boost::noncopyable {
+public:
+    ObjectGrid(float cellSize = kObjectGridCellSize) :
+        _cellSize(cellSize) {
+    }
+
+    void add(Object &object);
+    void remove(Object &object);
+    void update(Object &object);
+    void clear();
+
+    /**
+     * Appends objects of matching type, whose 2D distance to origin is less than radius, to outObjects.
+     */
+    void objectsInRadius(const glm::vec2 &origin, float radius, int typeMask, std::vector<Object *> &outObjects) const;
+
+    /**
+     * @param nth zero-based index of object, ordered by 2D distance to origin
+     * @return nth nearest object, that satisfies predicate, or nullptr if not found
+     */
+    Object *nearestObject(const glm::vec2 &origin, int nth, const std::function<bool(const Object &)> &pred) const;
+
+    size_t numObjects() const { return _objectCells.size(); }
+
+private:
+    float _cellSize;
+
+    std::unordered_map<uint64_t, std::vector<Object *>> _cells;
+    std::unordered_map<Object *, uint64_t> _objectCells;
+
+    // Bounds of cells, that were occupied since the last clear
+    glm::ivec2 _minCell {0};
+    glm::ivec2 _maxCell {0};
+
+    glm::ivec2 getCell(const glm::vec2 &position) const;
+
+    void addToCell(Object &object, const glm::ivec2 &cell);
+    void removeFromCell(Object &object, uint64_t key);
+
+    static uint64_t getCellKey(const glm::ivec2 &cell);
+};
+
+} // namespace game
+
+} // namespace reone
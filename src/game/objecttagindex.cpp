@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "objecttagindex.h"
+
+#include "object.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace game {
+
+static bool compareObjectIds(const Object *left, const Object *right) {
+    return left->id() < right->id();
+}
+
+void ObjectTagIndex::add(Object &object) {
+    auto &objects = _objects[boost::to_lower_copy(object.tag())];
+    auto it = lower_bound(objects.begin(), objects.end(), &object, compareObjectIds);
+    if (it != objects.end() && *it == &object) {
+        return;
+    }
+    objects.insert(it, &object);
+}
+
+void ObjectTagIndex::remove(Object &object) {
+    removeFromTag(object, object.tag());
+}
+
+void ObjectTagIndex::clear() {
+    _objects.clear();
+}
+
+void ObjectTagIndex::update(Object &object, const string &oldTag) {
+    if (removeFromTag(object, oldTag)) {
+        add(object);
+    }
+}
+
+Object *ObjectTagIndex::get(const string &tag, int nth) const {
+    auto it = _objects.find(boost::to_lower_copy(tag));
+    if (it == _objects.end() || nth < 0 || nth >= static_cast<int>(it->second.size())) {
+        return nullptr;
+    }
+    return it->second[nth];
+}
+
+bool ObjectTagIndex::removeFromTag(Object &object, const string &tag) {
+    auto it = _objects.find(boost::to_lower_copy(tag));
+    if (it == _objects.end()) {
+        return false;
+    }
+    auto &objects = it->second;
+    auto objIt = lower_bound(objects.begin(), objects.end(), &object, compareObjectIds);
+    if (objIt == objects.end() || *objIt != &object) {
+        return false;
+    }
+    objects.erase(objIt);
+    if (objects.empty()) {
+        _objects.erase(it);
+    }
+    return true;
+}
+
+} // namespace game
+
+} // namespace reone
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+namespace game {
+
+class Object;
+
+/**
+ * Case-insensitive index of objects by tag. Objects with the same tag are
+ * ordered by id, i.e. in spawn order.
+ */
+class ObjectTagIndex : boost::noncopyable {
+public:
+    void add(Object &object);
+    void remove(Object &object);
+    void clear();
+
+    /**
+     * Moves object from oldTag to its current tag, if object is indexed.
+     */
+    void update(Object &object, const std::string &oldTag);
+
+    /**
+     * @param nth zero-based index of object among objects with the same tag
+     * @return nth object with the specified tag or nullptr, if not found
+     */
+    Object *get(const std::string &tag, int nth = 0) const;
+
+private:
+    std::unordered_map<std::string, std::vector<Object *>> _objects;
+
+    bool removeFromTag(Object &object, const std::string &tag);
+};
+
+} // namespace game
+
+} // namespace reone
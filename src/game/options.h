@@ -29,6 +29,10 @@ struct GameOptions {
     boost::filesystem::path path;
     bool developer {false};
     bool neo {false};
+    bool profileScripts {false};
+    int scriptBudget {0};
+    int simRate {0}; /**< fixed simulation steps per second, 0 means variable timestep */
+    bool trace {false};
 };
 
 struct OptionsView {
@@ -118,31 +118,31 @@ Object *getTriggerrer(const RoutineContext &ctx) {
     return object;
 }
 
-int getInt(const vector<Variable> &args, int index) {
+int getInt(const ArgumentSpan &args, int index) {
     throwIfOutOfRange(args, index);
     throwIfUnexpectedType(VariableType::Int, args[index].type);
     return args[index].intValue;
 }
 
-float getFloat(const vector<Variable> &args, int index) {
+float getFloat(const ArgumentSpan &args, int index) {
     throwIfOutOfRange(args, index);
     throwIfUnexpectedType(VariableType::Float, args[index].type);
     return args[index].floatValue;
 }
 
-string getString(const vector<Variable> &args, int index) {
+string getString(const ArgumentSpan &args, int index) {
     throwIfOutOfRange(args, index);
     throwIfUnexpectedType(VariableType::String, args[index].type);
     return args[index].strValue;
 }
 
-glm::vec3 getVector(const vector<Variable> &args, int index) {
+glm::vec3 getVector(const ArgumentSpan &args, int index) {
     throwIfOutOfRange(args, index);
     throwIfUnexpectedType(VariableType::Vector, args[index].type);
     return args[index].vecValue;
 }
 
-Object *getObject(const vector<Variable> &args, int index, const RoutineContext &ctx) {
+Object *getObject(const ArgumentSpan &args, int index, const RoutineContext &ctx) {
     throwIfOutOfRange(args, index);
     throwIfUnexpectedType(VariableType::Object, args[index].type);
 
@@ -156,7 +156,7 @@ Object *getObject(const vector<Variable> &args, int index, const RoutineContext
     return move(object);
 }
 
-Effect *getEffect(const vector<Variable> &args, int index) {
+Effect *getEffect(const ArgumentSpan &args, int index) {
     throwIfOutOfRange(args, index);
     throwIfUnexpectedType(VariableType::Effect, args[index].type);
     auto effect = static_pointer_cast<Effect>(args[index].engineType);
@@ -164,7 +164,7 @@ Effect *getEffect(const vector<Variable> &args, int index) {
     return effect.get();
 }
 
-Event *getEvent(const vector<Variable> &args, int index) {
+Event *getEvent(const ArgumentSpan &args, int index) {
     throwIfOutOfRange(args, index);
     throwIfUnexpectedType(VariableType::Event, args[index].type);
     auto evt = static_pointer_cast<Event>(args[index].engineType);
@@ -172,7 +172,7 @@ Event *getEvent(const vector<Variable> &args, int index) {
     return evt.get();
 }
 
-Location *getLocationArgument(const vector<Variable> &args, int index) {
+Location *getLocationArgument(const ArgumentSpan &args, int index) {
     throwIfOutOfRange(args, index);
     throwIfUnexpectedType(VariableType::Location, args[index].type);
     auto location = static_pointer_cast<Location>(args[index].engineType);
@@ -180,7 +180,7 @@ Location *getLocationArgument(const vector<Variable> &args, int index) {
     return location.get();
 }
 
-Talent *getTalent(const vector<Variable> &args, int index) {
+Talent *getTalent(const ArgumentSpan &args, int index) {
     throwIfOutOfRange(args, index);
     throwIfUnexpectedType(VariableType::Talent, args[index].type);
     auto talent = static_pointer_cast<Talent>(args[index].engineType);
@@ -188,13 +188,13 @@ Talent *getTalent(const vector<Variable> &args, int index) {
     return talent.get();
 }
 
-shared_ptr<ExecutionContext> getAction(const vector<Variable> &args, int index) {
+shared_ptr<ExecutionContext> getAction(const ArgumentSpan &args, int index) {
     throwIfOutOfRange(args, index);
     throwIfUnexpectedType(VariableType::Action, args[index].type);
     return args[index].context;
 }
 
-int getIntOrElse(const vector<Variable> &args, int index, int defValue) {
+int getIntOrElse(const ArgumentSpan &args, int index, int defValue) {
     if (isOutOfRange(args, index)) {
         return defValue;
     }
@@ -202,7 +202,7 @@ int getIntOrElse(const vector<Variable> &args, int index, int defValue) {
     return args[index].intValue;
 }
 
-float getFloatOrElse(const vector<Variable> &args, int index, float defValue) {
+float getFloatOrElse(const ArgumentSpan &args, int index, float defValue) {
     if (isOutOfRange(args, index)) {
         return defValue;
     }
@@ -210,7 +210,7 @@ float getFloatOrElse(const vector<Variable> &args, int index, float defValue) {
     return args[index].floatValue;
 }
 
-string getStringOrElse(const vector<Variable> &args, int index, string defValue) {
+string getStringOrElse(const ArgumentSpan &args, int index, string defValue) {
     if (isOutOfRange(args, index)) {
         return defValue;
     }
@@ -218,7 +218,7 @@ string getStringOrElse(const vector<Variable> &args, int index, string defValue)
     return args[index].strValue;
 }
 
-glm::vec3 getVectorOrElse(const vector<Variable> &args, int index, glm::vec3 defValue) {
+glm::vec3 getVectorOrElse(const ArgumentSpan &args, int index, glm::vec3 defValue) {
     if (isOutOfRange(args, index)) {
         return defValue;
     }
@@ -226,13 +226,13 @@ glm::vec3 getVectorOrElse(const vector<Variable> &args, int index, glm::vec3 def
     return args[index].vecValue;
 }
 
-bool getIntAsBool(const vector<Variable> &args, int index) {
+bool getIntAsBool(const ArgumentSpan &args, int index) {
     throwIfOutOfRange(args, index);
     throwIfUnexpectedType(VariableType::Int, args[index].type);
     return static_cast<bool>(args[index].intValue);
 }
 
-bool getIntAsBoolOrElse(const vector<Variable> &args, int index, bool defValue) {
+bool getIntAsBoolOrElse(const ArgumentSpan &args, int index, bool defValue) {
     if (isOutOfRange(args, index)) {
         return defValue;
     }
@@ -240,7 +240,7 @@ bool getIntAsBoolOrElse(const vector<Variable> &args, int index, bool defValue)
     return static_cast<bool>(args[index].intValue);
 }
 
-Object *getObjectOrNull(const vector<Variable> &args, int index, const RoutineContext &ctx) {
+Object *getObjectOrNull(const ArgumentSpan &args, int index, const RoutineContext &ctx) {
     if (isOutOfRange(args, index)) {
         return nullptr;
     } else {
@@ -248,7 +248,7 @@ Object *getObjectOrNull(const vector<Variable> &args, int index, const RoutineCo
     }
 }
 
-Object *getObjectOrCaller(const vector<Variable> &args, int index, const RoutineContext &ctx) {
+Object *getObjectOrCaller(const ArgumentSpan &args, int index, const RoutineContext &ctx) {
     if (isOutOfRange(args, index)) {
         return getCaller(ctx);
     } else {
@@ -262,13 +262,13 @@ Creature *getCallerAsCreature(const RoutineContext &ctx) {
     return static_cast<Creature *>(caller);
 }
 
-Creature *getObjectAsCreature(const vector<Variable> &args, int index, const RoutineContext &ctx) {
+Creature *getObjectAsCreature(const ArgumentSpan &args, int index, const RoutineContext &ctx) {
     auto object = getObject(args, index, ctx);
     throwIfObjectNotCreature(object);
     return static_cast<Creature *>(object);
 }
 
-Creature *getObjectOrCallerAsCreature(const vector<Variable> &args, int index, const RoutineContext &ctx) {
+Creature *getObjectOrCallerAsCreature(const ArgumentSpan &args, int index, const RoutineContext &ctx) {
     if (isOutOfRange(args, index)) {
         return getCallerAsCreature(ctx);
     } else {
@@ -276,25 +276,25 @@ Creature *getObjectOrCallerAsCreature(const vector<Variable> &args, int index, c
     }
 }
 
-Door *getObjectAsDoor(const vector<Variable> &args, int index, const RoutineContext &ctx) {
+Door *getObjectAsDoor(const ArgumentSpan &args, int index, const RoutineContext &ctx) {
     auto object = getObject(args, index, ctx);
     throwIfObjectNotDoor(object);
     return static_cast<Door *>(object);
 }
 
-Placeable *getObjectAsPlaceable(const vector<Variable> &args, int index, const RoutineContext &ctx) {
+Placeable *getObjectAsPlaceable(const ArgumentSpan &args, int index, const RoutineContext &ctx) {
     auto object = getObject(args, index, ctx);
     throwIfObjectNotPlaceable(object);
     return static_cast<Placeable *>(object);
 }
 
-Item *getObjectAsItem(const vector<Variable> &args, int index, const RoutineContext &ctx) {
+Item *getObjectAsItem(const ArgumentSpan &args, int index, const RoutineContext &ctx) {
     auto object = getObject(args, index, ctx);
     throwIfObjectNotItem(object);
     return static_cast<Item *>(object);
 }
 
-Item *getObjectAsItemOrNull(const vector<Variable> &args, int index, const RoutineContext &ctx) {
+Item *getObjectAsItemOrNull(const ArgumentSpan &args, int index, const RoutineContext &ctx) {
     if (isOutOfRange(args, index)) {
         return nullptr;
     } else {
@@ -302,13 +302,13 @@ Item *getObjectAsItemOrNull(const vector<Variable> &args, int index, const Routi
     }
 }
 
-Sound *getObjectAsSound(const vector<Variable> &args, int index, const RoutineContext &ctx) {
+Sound *getObjectAsSound(const ArgumentSpan &args, int index, const RoutineContext &ctx) {
     auto object = getObject(args, index, ctx);
     throwIfObjectNotSound(object);
     return static_cast<Sound *>(object);
 }
 
-Area *getObjectAsArea(const vector<script::Variable> &args, int index, const RoutineContext &ctx) {
+Area *getObjectAsArea(const ArgumentSpan &args, int index, const RoutineContext &ctx) {
     throwIfOutOfRange(args, 0);
     throwIfUnexpectedType(VariableType::Object, args[index].type);
 
@@ -322,7 +322,7 @@ Area *getObjectAsArea(const vector<script::Variable> &args, int index, const Rou
     return static_cast<Area *>(object);
 }
 
-Area *getObjectAsAreaOrCallerArea(const vector<script::Variable> &args, int index, const RoutineContext &ctx) {
+Area *getObjectAsAreaOrCallerArea(const ArgumentSpan &args, int index, const RoutineContext &ctx) {
     /*
     if (isOutOfRange(args, index)) {
         return ctx.game.module()->area();
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "../../../common/collectionutil.h"
+#include "../../../script/argumentspan.h"
 #include "../../../script/exception/argument.h"
 #include "../../../script/types.h"
 #include "../../../script/variable.h"
@@ -49,45 +50,45 @@ class Talent;
 Object *getCaller(const RoutineContext &ctx);
 Object *getTriggerrer(const RoutineContext &ctx);
 
-int getInt(const std::vector<script::Variable> &args, int index);
-float getFloat(const std::vector<script::Variable> &args, int index);
-std::string getString(const std::vector<script::Variable> &args, int index);
-glm::vec3 getVector(const std::vector<script::Variable> &args, int index);
-Object *getObject(const std::vector<script::Variable> &args, int index, const RoutineContext &ctx);
-Effect *getEffect(const std::vector<script::Variable> &args, int index);
-Event *getEvent(const std::vector<script::Variable> &args, int index);
-Location *getLocationArgument(const std::vector<script::Variable> &args, int index);
-Talent *getTalent(const std::vector<script::Variable> &args, int index);
-std::shared_ptr<script::ExecutionContext> getAction(const std::vector<script::Variable> &args, int index);
+int getInt(const script::ArgumentSpan &args, int index);
+float getFloat(const script::ArgumentSpan &args, int index);
+std::string getString(const script::ArgumentSpan &args, int index);
+glm::vec3 getVector(const script::ArgumentSpan &args, int index);
+Object *getObject(const script::ArgumentSpan &args, int index, const RoutineContext &ctx);
+Effect *getEffect(const script::ArgumentSpan &args, int index);
+Event *getEvent(const script::ArgumentSpan &args, int index);
+Location *getLocationArgument(const script::ArgumentSpan &args, int index);
+Talent *getTalent(const script::ArgumentSpan &args, int index);
+std::shared_ptr<script::ExecutionContext> getAction(const script::ArgumentSpan &args, int index);
 
-int getIntOrElse(const std::vector<script::Variable> &args, int index, int defValue);
-float getFloatOrElse(const std::vector<script::Variable> &args, int index, float defValue);
-std::string getStringOrElse(const std::vector<script::Variable> &args, int index, std::string defValue);
-glm::vec3 getVectorOrElse(const std::vector<script::Variable> &args, int index, glm::vec3 defValue);
+int getIntOrElse(const script::ArgumentSpan &args, int index, int defValue);
+float getFloatOrElse(const script::ArgumentSpan &args, int index, float defValue);
+std::string getStringOrElse(const script::ArgumentSpan &args, int index, std::string defValue);
+glm::vec3 getVectorOrElse(const script::ArgumentSpan &args, int index, glm::vec3 defValue);
 
-bool getIntAsBool(const std::vector<script::Variable> &args, int index);
-bool getIntAsBoolOrElse(const std::vector<script::Variable> &args, int index, bool defValue);
+bool getIntAsBool(const script::ArgumentSpan &args, int index);
+bool getIntAsBoolOrElse(const script::ArgumentSpan &args, int index, bool defValue);
 
-Object *getObjectOrNull(const std::vector<script::Variable> &args, int index, const RoutineContext &ctx);
-Object *getObjectOrCaller(const std::vector<script::Variable> &args, int index, const RoutineContext &ctx);
+Object *getObjectOrNull(const script::ArgumentSpan &args, int index, const RoutineContext &ctx);
+Object *getObjectOrCaller(const script::ArgumentSpan &args, int index, const RoutineContext &ctx);
 
 Creature *getCallerAsCreature(const RoutineContext &ctx);
-Creature *getObjectAsCreature(const std::vector<script::Variable> &args, int index, const RoutineContext &ctx);
-Creature *getObjectOrCallerAsCreature(const std::vector<script::Variable> &args, int index, const RoutineContext &ctx);
+Creature *getObjectAsCreature(const script::ArgumentSpan &args, int index, const RoutineContext &ctx);
+Creature *getObjectOrCallerAsCreature(const script::ArgumentSpan &args, int index, const RoutineContext &ctx);
 
-Door *getObjectAsDoor(const std::vector<script::Variable> &args, int index, const RoutineContext &ctx);
+Door *getObjectAsDoor(const script::ArgumentSpan &args, int index, const RoutineContext &ctx);
 
-Placeable *getObjectAsPlaceable(const std::vector<script::Variable> &args, int index, const RoutineContext &ctx);
+Placeable *getObjectAsPlaceable(const script::ArgumentSpan &args, int index, const RoutineContext &ctx);
 
-Item *getObjectAsItem(const std::vector<script::Variable> &args, int index, const RoutineContext &ctx);
-Item *getObjectAsItemOrNull(const std::vector<script::Variable> &args, int index, const RoutineContext &ctx);
+Item *getObjectAsItem(const script::ArgumentSpan &args, int index, const RoutineContext &ctx);
+Item *getObjectAsItemOrNull(const script::ArgumentSpan &args, int index, const RoutineContext &ctx);
 
-Sound *getObjectAsSound(const std::vector<script::Variable> &args, int index, const RoutineContext &ctx);
+Sound *getObjectAsSound(const script::ArgumentSpan &args, int index, const RoutineContext &ctx);
 
-Area *getObjectAsArea(const std::vector<script::Variable> &args, int index, const RoutineContext &ctx);
-Area *getObjectAsAreaOrCallerArea(const std::vector<script::Variable> &args, int index, const RoutineContext &ctx);
+Area *getObjectAsArea(const script::ArgumentSpan &args, int index, const RoutineContext &ctx);
+Area *getObjectAsAreaOrCallerArea(const script::ArgumentSpan &args, int index, const RoutineContext &ctx);
 
-inline void throwIfOutOfRange(const std::vector<script::Variable> &args, int index) {
+inline void throwIfOutOfRange(const script::ArgumentSpan &args, int index) {
     if (isOutOfRange(args, index)) {
         throw script::ArgumentException(str(boost::format("Argument index is out of range: %d/%d") % index % static_cast<int>(args.size())));
     }
@@ -100,14 +101,14 @@ inline void throwIfUnexpectedType(script::VariableType expected, script::Variabl
 }
 
 template <class T>
-inline T getIntAsEnum(const std::vector<script::Variable> &args, int index) {
+inline T getIntAsEnum(const script::ArgumentSpan &args, int index) {
     throwIfOutOfRange(args, index);
     throwIfUnexpectedType(script::VariableType::Int, args[index].type);
     return static_cast<T>(args[index].intValue);
 }
 
 template <class T>
-inline T getIntAsEnumOrElse(const std::vector<script::Variable> &args, int index, T defValue) {
+inline T getIntAsEnumOrElse(const script::ArgumentSpan &args, int index, T defValue) {
     if (isOutOfRange(args, index)) {
         return defValue;
     }
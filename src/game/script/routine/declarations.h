@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "../../../script/argumentspan.h"
 #include "../../../script/variable.h"
 
 namespace reone {
@@ -27,7 +28,7 @@ struct RoutineContext;
 
 namespace routine {
 
-#define R_ROUTINE(x) script::Variable(x)(const std::vector<script::Variable> &args, const RoutineContext &ctx);
+#define R_ROUTINE(x) script::Variable(x)(const script::ArgumentSpan &args, const RoutineContext &ctx);
 
 R_ROUTINE(unsupported)
 
@@ -35,13 +35,13 @@ namespace game {
 
 namespace routine {
 
-Variable actionRandomWalk(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionRandomWalk(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofNull();
 }
 
-Variable actionMoveToLocation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionMoveToLocation(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto destination = getLocationArgument(args, 0);
     bool run = getIntAsBoolOrElse(args, 1, false);
 
@@ -50,7 +50,7 @@ Variable actionMoveToLocation(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable actionMoveToObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionMoveToObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto moveTo = getObject(args, 0, ctx);
     bool run = getIntAsBoolOrElse(args, 1, false);
     float range = getFloatOrElse(args, 2, 1.0f);
@@ -60,7 +60,7 @@ Variable actionMoveToObject(const vector<Variable> &args, const RoutineContext &
     return Variable::ofNull();
 }
 
-Variable actionMoveAwayFromObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionMoveAwayFromObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto fleeFrom = getObject(args, 0, ctx);
     bool run = getIntAsBoolOrElse(args, 1, false);
     float range = getFloatOrElse(args, 2, 40.0f);
@@ -70,7 +70,7 @@ Variable actionMoveAwayFromObject(const vector<Variable> &args, const RoutineCon
     return Variable::ofNull();
 }
 
-Variable actionEquipItem(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionEquipItem(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto item = getObjectAsItem(args, 0, ctx);
     int inventorySlot = getInt(args, 1);
     bool instant = getIntAsBoolOrElse(args, 2, false);
@@ -80,7 +80,7 @@ Variable actionEquipItem(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofNull();
 }
 
-Variable actionUnequipItem(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionUnequipItem(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto item = getObjectAsItem(args, 0, ctx);
     bool instant = getIntAsBoolOrElse(args, 1, false);
 
@@ -89,7 +89,7 @@ Variable actionUnequipItem(const vector<Variable> &args, const RoutineContext &c
     return Variable::ofNull();
 }
 
-Variable actionAttack(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionAttack(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto attackee = getObject(args, 0, ctx);
     bool passive = getIntAsBoolOrElse(args, 1, false);
 
@@ -98,7 +98,7 @@ Variable actionAttack(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable actionPlayAnimation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionPlayAnimation(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto animation = getIntAsEnum<AnimationType>(args, 0);
     float speed = getFloatOrElse(args, 1, 1.0f);
     float durationSeconds = getFloatOrElse(args, 2, 0.0f);
@@ -108,7 +108,7 @@ Variable actionPlayAnimation(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable actionOpenDoor(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionOpenDoor(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto door = getObjectAsDoor(args, 0, ctx);
 
     // TODO: implement
@@ -116,7 +116,7 @@ Variable actionOpenDoor(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable actionCloseDoor(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionCloseDoor(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto door = getObjectAsDoor(args, 0, ctx);
 
     // TODO: implement
@@ -124,7 +124,7 @@ Variable actionCloseDoor(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofNull();
 }
 
-Variable actionCastSpellAtObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionCastSpellAtObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto spell = getIntAsEnum<SpellType>(args, 0);
     auto target = getObject(args, 1, ctx);
     int metaMagic = getIntOrElse(args, 2, 0);
@@ -138,7 +138,7 @@ Variable actionCastSpellAtObject(const vector<Variable> &args, const RoutineCont
     return Variable::ofNull();
 }
 
-Variable actionGiveItem(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionGiveItem(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto item = getObjectAsItem(args, 0, ctx);
     auto giveTo = getObject(args, 1, ctx);
 
@@ -147,7 +147,7 @@ Variable actionGiveItem(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable actionTakeItem(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionTakeItem(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto item = getObjectAsItem(args, 0, ctx);
     auto takeFrom = getObject(args, 1, ctx);
 
@@ -156,7 +156,7 @@ Variable actionTakeItem(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable actionJumpToObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionJumpToObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto jumpTo = getObject(args, 0, ctx);
     bool walkStraightLine = getIntAsBoolOrElse(args, 1, true);
 
@@ -165,7 +165,7 @@ Variable actionJumpToObject(const vector<Variable> &args, const RoutineContext &
     return Variable::ofNull();
 }
 
-Variable actionWait(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionWait(const ArgumentSpan &args, const RoutineContext &ctx) {
     float seconds = getFloat(args, 0);
 
     // TODO: implement
@@ -173,7 +173,7 @@ Variable actionWait(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable actionStartConversation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionStartConversation(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto objectToConverse = getObject(args, 0, ctx);
     string dialogResRef = getStringOrElse(args, 1, "");
     bool privateConversation = getIntAsBoolOrElse(args, 2, false);
@@ -195,19 +195,19 @@ Variable actionStartConversation(const vector<Variable> &args, const RoutineCont
     return Variable::ofNull();
 }
 
-Variable actionPauseConversation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionPauseConversation(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofNull();
 }
 
-Variable actionResumeConversation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionResumeConversation(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofNull();
 }
 
-Variable actionJumpToLocation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionJumpToLocation(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto location = getLocationArgument(args, 0);
 
     // TODO: implement
@@ -215,7 +215,7 @@ Variable actionJumpToLocation(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable actionUseSkill(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionUseSkill(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto skill = getIntAsEnum<SkillType>(args, 0);
     auto target = getObject(args, 1, ctx);
     int subSkill = getIntOrElse(args, 2, 0);
@@ -226,7 +226,7 @@ Variable actionUseSkill(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable actionDoCommand(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionDoCommand(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto action = getAction(args, 0);
 
     // TODO: implement
@@ -234,7 +234,7 @@ Variable actionDoCommand(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofNull();
 }
 
-Variable actionUseTalentOnObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionUseTalentOnObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto chosenTalent = getTalent(args, 0);
     auto target = getObject(args, 1, ctx);
 
@@ -243,7 +243,7 @@ Variable actionUseTalentOnObject(const vector<Variable> &args, const RoutineCont
     return Variable::ofNull();
 }
 
-Variable actionInteractObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionInteractObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto placeable = getObjectAsPlaceable(args, 0, ctx);
 
     // TODO: implement
@@ -251,13 +251,13 @@ Variable actionInteractObject(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable actionSurrenderToEnemies(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionSurrenderToEnemies(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofNull();
 }
 
-Variable actionForceMoveToLocation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionForceMoveToLocation(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto destination = getLocationArgument(args, 0);
     bool run = getIntAsBoolOrElse(args, 1, false);
     float timeout = getFloatOrElse(args, 2, 30.0f);
@@ -267,7 +267,7 @@ Variable actionForceMoveToLocation(const vector<Variable> &args, const RoutineCo
     return Variable::ofNull();
 }
 
-Variable actionForceMoveToObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionForceMoveToObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto moveTo = getObject(args, 0, ctx);
     bool run = getIntAsBoolOrElse(args, 1, false);
     float range = getFloatOrElse(args, 2, 1.0f);
@@ -278,7 +278,7 @@ Variable actionForceMoveToObject(const vector<Variable> &args, const RoutineCont
     return Variable::ofNull();
 }
 
-Variable actionEquipMostDamagingMelee(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionEquipMostDamagingMelee(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto versus = getObjectOrNull(args, 0, ctx);
     bool offHand = getIntAsBoolOrElse(args, 1, false);
 
@@ -287,7 +287,7 @@ Variable actionEquipMostDamagingMelee(const vector<Variable> &args, const Routin
     return Variable::ofNull();
 }
 
-Variable actionEquipMostDamagingRanged(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionEquipMostDamagingRanged(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto versus = getObjectOrNull(args, 0, ctx);
 
     // TODO: implement
@@ -295,7 +295,7 @@ Variable actionEquipMostDamagingRanged(const vector<Variable> &args, const Routi
     return Variable::ofNull();
 }
 
-Variable actionUnlockObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionUnlockObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target = getObject(args, 0, ctx);
 
     // TODO: implement
@@ -303,7 +303,7 @@ Variable actionUnlockObject(const vector<Variable> &args, const RoutineContext &
     return Variable::ofNull();
 }
 
-Variable actionLockObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionLockObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target = getObject(args, 0, ctx);
 
     // TODO: implement
@@ -311,7 +311,7 @@ Variable actionLockObject(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofNull();
 }
 
-Variable actionCastFakeSpellAtObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionCastFakeSpellAtObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto spell = getIntAsEnum<SpellType>(args, 0);
     auto target = getObject(args, 1, ctx);
     auto projectilePathType = getIntAsEnum<ProjectilePathType>(args, 2);
@@ -321,7 +321,7 @@ Variable actionCastFakeSpellAtObject(const vector<Variable> &args, const Routine
     return Variable::ofNull();
 }
 
-Variable actionCastFakeSpellAtLocation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionCastFakeSpellAtLocation(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto spell = getIntAsEnum<SpellType>(args, 0);
     auto location = getLocationArgument(args, 1);
     auto projectilePathType = getIntAsEnum<ProjectilePathType>(args, 2);
@@ -331,7 +331,7 @@ Variable actionCastFakeSpellAtLocation(const vector<Variable> &args, const Routi
     return Variable::ofNull();
 }
 
-Variable actionBarkString(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionBarkString(const ArgumentSpan &args, const RoutineContext &ctx) {
     int strRef = getInt(args, 0);
 
     // TODO: implement
@@ -339,7 +339,7 @@ Variable actionBarkString(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofNull();
 }
 
-Variable actionFollowLeader(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionFollowLeader(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofNull();
@@ -347,7 +347,7 @@ Variable actionFollowLeader(const vector<Variable> &args, const RoutineContext &
 
 // TSL
 
-Variable actionFollowOwner(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionFollowOwner(const ArgumentSpan &args, const RoutineContext &ctx) {
     float range = getFloatOrElse(args, 0, 2.5f);
 
     // TODO: implement
@@ -355,7 +355,7 @@ Variable actionFollowOwner(const vector<Variable> &args, const RoutineContext &c
     return Variable::ofNull();
 }
 
-Variable actionSwitchWeapons(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable actionSwitchWeapons(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofNull();
@@ -39,13 +39,13 @@ namespace routine {
 
 static constexpr int kAcVsDamageTypeAll = 8199;
 
-Variable effectAssuredHit(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectAssuredHit(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectHeal(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectHeal(const ArgumentSpan &args, const RoutineContext &ctx) {
     int damageToHeal = getInt(args, 0);
 
     // TODO: implement
@@ -53,7 +53,7 @@ Variable effectHeal(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectDamage(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectDamage(const ArgumentSpan &args, const RoutineContext &ctx) {
     int damageAmount = getInt(args, 0);
     auto damageType = getIntAsEnumOrElse(args, 1, DamageType::Universal);
     auto damagePower = getIntAsEnumOrElse(args, 2, DamagePower::Normal);
@@ -63,7 +63,7 @@ Variable effectDamage(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectAbilityIncrease(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectAbilityIncrease(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto abilityToIncrease = getIntAsEnum<Ability>(args, 0);
     int modifyBy = getInt(args, 1);
 
@@ -72,7 +72,7 @@ Variable effectAbilityIncrease(const vector<Variable> &args, const RoutineContex
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectDamageResistance(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectDamageResistance(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto damageType = getIntAsEnum<DamageType>(args, 0);
     int amount = getInt(args, 1);
     int limit = getIntOrElse(args, 2, 0);
@@ -82,7 +82,7 @@ Variable effectDamageResistance(const vector<Variable> &args, const RoutineConte
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectResurrection(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectResurrection(const ArgumentSpan &args, const RoutineContext &ctx) {
     int hpPercent = getIntOrElse(args, 0, 0);
 
     // TODO: implement
@@ -90,7 +90,7 @@ Variable effectResurrection(const vector<Variable> &args, const RoutineContext &
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectACIncrease(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectACIncrease(const ArgumentSpan &args, const RoutineContext &ctx) {
     int value = getInt(args, 0);
     auto modifyType = getIntAsEnumOrElse(args, 1, ACBonus::Dodge);
     int damageType = getIntOrElse(args, 2, kAcVsDamageTypeAll);
@@ -100,7 +100,7 @@ Variable effectACIncrease(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectSavingThrowIncrease(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectSavingThrowIncrease(const ArgumentSpan &args, const RoutineContext &ctx) {
     int save = getInt(args, 0);
     int value = getInt(args, 1);
     auto saveType = getIntAsEnumOrElse(args, 2, SavingThrowType::All);
@@ -110,7 +110,7 @@ Variable effectSavingThrowIncrease(const vector<Variable> &args, const RoutineCo
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectAttackIncrease(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectAttackIncrease(const ArgumentSpan &args, const RoutineContext &ctx) {
     int bonus = getInt(args, 0);
     auto modifierType = getIntAsEnumOrElse(args, 1, AttackBonus::Misc);
 
@@ -119,19 +119,19 @@ Variable effectAttackIncrease(const vector<Variable> &args, const RoutineContext
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectDamageIncrease(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectDamageIncrease(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectEntangle(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectEntangle(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectDeath(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectDeath(const ArgumentSpan &args, const RoutineContext &ctx) {
     bool spectacularDeath = getIntAsBoolOrElse(args, 0, false);
     bool displayFeedback = getIntAsBoolOrElse(args, 1, true);
     bool noFadeAway = getIntAsBoolOrElse(args, 2, false);
@@ -141,19 +141,19 @@ Variable effectDeath(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectParalyze(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectParalyze(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectSleep(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectSleep(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectTemporaryForcePoints(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectTemporaryForcePoints(const ArgumentSpan &args, const RoutineContext &ctx) {
     int tempForce = getInt(args, 0);
 
     // TODO: implement
@@ -161,19 +161,19 @@ Variable effectTemporaryForcePoints(const vector<Variable> &args, const RoutineC
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectChoke(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectChoke(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectStunned(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectStunned(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectRegenerate(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectRegenerate(const ArgumentSpan &args, const RoutineContext &ctx) {
     int amount = getInt(args, 0);
     float intervalSeconds = getFloat(args, 1);
 
@@ -182,7 +182,7 @@ Variable effectRegenerate(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectMovementSpeedIncrease(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectMovementSpeedIncrease(const ArgumentSpan &args, const RoutineContext &ctx) {
     int newSpeedPercent = getInt(args, 0);
 
     // TODO: implement
@@ -190,7 +190,7 @@ Variable effectMovementSpeedIncrease(const vector<Variable> &args, const Routine
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectVisualEffect(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectVisualEffect(const ArgumentSpan &args, const RoutineContext &ctx) {
     int visualEffectId = getInt(args, 0);
     bool missEffect = getIntAsBoolOrElse(args, 1, false);
 
@@ -199,7 +199,7 @@ Variable effectVisualEffect(const vector<Variable> &args, const RoutineContext &
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectLinkEffects(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectLinkEffects(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto childEffect = getEffect(args, 0);
     auto parentEffect = getEffect(args, 1);
 
@@ -208,7 +208,7 @@ Variable effectLinkEffects(const vector<Variable> &args, const RoutineContext &c
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectBeam(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectBeam(const ArgumentSpan &args, const RoutineContext &ctx) {
     int beamVisualEffect = getInt(args, 0);
     auto effector = getObject(args, 1, ctx);
     auto bodyPart = getIntAsEnum<BodyNode>(args, 2);
@@ -219,7 +219,7 @@ Variable effectBeam(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectForceResistanceIncrease(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectForceResistanceIncrease(const ArgumentSpan &args, const RoutineContext &ctx) {
     int value = getInt(args, 0);
 
     // TODO: implement
@@ -227,13 +227,13 @@ Variable effectForceResistanceIncrease(const vector<Variable> &args, const Routi
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectBodyFuel(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectBodyFuel(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectPoison(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectPoison(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto poisonType = getIntAsEnum<Poison>(args, 0);
 
     // TODO: implement
@@ -241,7 +241,7 @@ Variable effectPoison(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectForcePushTargeted(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectForcePushTargeted(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto centre = getLocationArgument(args, 0);
     bool ignoreTestDirectLine = getIntAsBoolOrElse(args, 1, false);
 
@@ -250,7 +250,7 @@ Variable effectForcePushTargeted(const vector<Variable> &args, const RoutineCont
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectImmunity(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectImmunity(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto immunityType = getIntAsEnum<ImmunityType>(args, 0);
 
     // TODO: implement
@@ -258,7 +258,7 @@ Variable effectImmunity(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectDamageImmunityIncrease(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectDamageImmunityIncrease(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto damageType = getIntAsEnum<DamageType>(args, 0);
     int percentImmunity = getInt(args, 1);
 
@@ -267,7 +267,7 @@ Variable effectDamageImmunityIncrease(const vector<Variable> &args, const Routin
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectTemporaryHitpoints(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectTemporaryHitpoints(const ArgumentSpan &args, const RoutineContext &ctx) {
     int hitPoints = getInt(args, 0);
 
     // TODO: implement
@@ -275,7 +275,7 @@ Variable effectTemporaryHitpoints(const vector<Variable> &args, const RoutineCon
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectSkillIncrease(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectSkillIncrease(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto skill = getIntAsEnum<SkillType>(args, 0);
     int value = getInt(args, 1);
 
@@ -284,7 +284,7 @@ Variable effectSkillIncrease(const vector<Variable> &args, const RoutineContext
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectDamageForcePoints(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectDamageForcePoints(const ArgumentSpan &args, const RoutineContext &ctx) {
     int damage = getInt(args, 0);
 
     // TODO: implement
@@ -292,7 +292,7 @@ Variable effectDamageForcePoints(const vector<Variable> &args, const RoutineCont
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectHealForcePoints(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectHealForcePoints(const ArgumentSpan &args, const RoutineContext &ctx) {
     int heal = getInt(args, 0);
 
     // TODO: implement
@@ -300,31 +300,31 @@ Variable effectHealForcePoints(const vector<Variable> &args, const RoutineContex
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectDroidStun(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectDroidStun(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectForcePushed(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectForcePushed(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectForceResisted(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectForceResisted(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectForceFizzle(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectForceFizzle(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectAbilityDecrease(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectAbilityDecrease(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto ability = getIntAsEnum<Ability>(args, 0);
     int modifyBy = getInt(args, 1);
 
@@ -333,13 +333,13 @@ Variable effectAbilityDecrease(const vector<Variable> &args, const RoutineContex
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectAttackDecrease(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectAttackDecrease(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectDamageDecrease(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectDamageDecrease(const ArgumentSpan &args, const RoutineContext &ctx) {
     int penalty = getInt(args, 0);
     auto modifierType = getIntAsEnumOrElse(args, 1, AttackBonus::Misc);
 
@@ -348,7 +348,7 @@ Variable effectDamageDecrease(const vector<Variable> &args, const RoutineContext
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectACDecrease(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectACDecrease(const ArgumentSpan &args, const RoutineContext &ctx) {
     int value = getInt(args, 0);
     auto modifyType = getIntAsEnumOrElse(args, 1, ACBonus::Dodge);
     int damageType = getIntOrElse(args, 2, kAcVsDamageTypeAll);
@@ -358,7 +358,7 @@ Variable effectACDecrease(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectMovementSpeedDecrease(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectMovementSpeedDecrease(const ArgumentSpan &args, const RoutineContext &ctx) {
     int percentChange = getInt(args, 0);
 
     // TODO: implement
@@ -366,7 +366,7 @@ Variable effectMovementSpeedDecrease(const vector<Variable> &args, const Routine
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectSavingThrowDecrease(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectSavingThrowDecrease(const ArgumentSpan &args, const RoutineContext &ctx) {
     int save = getInt(args, 0);
     int value = getInt(args, 1);
     auto saveType = getIntAsEnumOrElse(args, 2, SavingThrowType::All);
@@ -376,7 +376,7 @@ Variable effectSavingThrowDecrease(const vector<Variable> &args, const RoutineCo
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectInvisibility(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectInvisibility(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto invisibilityType = getIntAsEnum<InvisibilityType>(args, 0);
 
     // TODO: implement
@@ -384,7 +384,7 @@ Variable effectInvisibility(const vector<Variable> &args, const RoutineContext &
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectForceShield(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectForceShield(const ArgumentSpan &args, const RoutineContext &ctx) {
     int shield = getInt(args, 0);
 
     // TODO: implement
@@ -392,7 +392,7 @@ Variable effectForceShield(const vector<Variable> &args, const RoutineContext &c
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectDisguise(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectDisguise(const ArgumentSpan &args, const RoutineContext &ctx) {
     int disguiseAppearance = getInt(args, 0);
 
     // TODO: implement
@@ -400,13 +400,13 @@ Variable effectDisguise(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectTrueSeeing(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectTrueSeeing(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectBlasterDeflectionIncrease(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectBlasterDeflectionIncrease(const ArgumentSpan &args, const RoutineContext &ctx) {
     int change = getInt(args, 0);
 
     // TODO: implement
@@ -414,13 +414,13 @@ Variable effectBlasterDeflectionIncrease(const vector<Variable> &args, const Rou
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectHorrified(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectHorrified(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectModifyAttacks(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectModifyAttacks(const ArgumentSpan &args, const RoutineContext &ctx) {
     int attacks = getInt(args, 0);
 
     // TODO: implement
@@ -428,13 +428,13 @@ Variable effectModifyAttacks(const vector<Variable> &args, const RoutineContext
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectPsychicStatic(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectPsychicStatic(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectLightsaberThrow(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectLightsaberThrow(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target1 = getObject(args, 0, ctx);
     auto target2 = getObjectOrNull(args, 1, ctx);
     auto target3 = getObjectOrNull(args, 2, ctx);
@@ -445,25 +445,25 @@ Variable effectLightsaberThrow(const vector<Variable> &args, const RoutineContex
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectWhirlWind(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectWhirlWind(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectCutSceneHorrified(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectCutSceneHorrified(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectCutSceneParalyze(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectCutSceneParalyze(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectCutSceneStunned(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectCutSceneStunned(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
@@ -471,7 +471,7 @@ Variable effectCutSceneStunned(const vector<Variable> &args, const RoutineContex
 
 // TSL
 
-Variable effectForceBody(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectForceBody(const ArgumentSpan &args, const RoutineContext &ctx) {
     int level = getInt(args, 0);
 
     // TODO: implement
@@ -479,19 +479,19 @@ Variable effectForceBody(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectFury(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectFury(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectBlind(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectBlind(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectVPRegenModifier(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectVPRegenModifier(const ArgumentSpan &args, const RoutineContext &ctx) {
     int percent = getInt(args, 0);
 
     // TODO: implement
@@ -499,25 +499,25 @@ Variable effectVPRegenModifier(const vector<Variable> &args, const RoutineContex
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectCrush(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectCrush(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectForceSight(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectForceSight(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectMindTrick(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectMindTrick(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectFactionModifier(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectFactionModifier(const ArgumentSpan &args, const RoutineContext &ctx) {
     int newFaction = getInt(args, 0);
 
     // TODO: implement
@@ -525,7 +525,7 @@ Variable effectFactionModifier(const vector<Variable> &args, const RoutineContex
     return Variable::ofEffect(nullptr);
 }
 
-Variable effectDroidScramble(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable effectDroidScramble(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofEffect(nullptr);
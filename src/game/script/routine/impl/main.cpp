@@ -54,25 +54,25 @@ namespace routine {
 
 static constexpr bool kShipBuild = true;
 
-Variable unsupported(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable unsupported(const ArgumentSpan &args, const RoutineContext &ctx) {
     throw UnsupportedRoutineException();
 }
 
-Variable random(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable random(const ArgumentSpan &args, const RoutineContext &ctx) {
     int maxInteger = getInt(args, 0);
     int result = reone::random(0, maxInteger - 1);
 
     return Variable::ofInt(result);
 }
 
-Variable printString(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable printString(const ArgumentSpan &args, const RoutineContext &ctx) {
     string str = getString(args, 0);
     info(str);
 
     return Variable::ofNull();
 }
 
-Variable floatToString(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable floatToString(const ArgumentSpan &args, const RoutineContext &ctx) {
     float flt = getFloat(args, 0);
     int width = getIntOrElse(args, 1, 18);
     int decimals = getIntOrElse(args, 2, 9);
@@ -82,25 +82,25 @@ Variable floatToString(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofString(to_string(flt));
 }
 
-Variable assignCommand(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable assignCommand(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto actionSubject = getObject(args, 0, ctx);
     auto actionToAssign = getAction(args, 1);
 
-    // TODO: implement
+    ctx.game.delayCommand(actionSubject->id(), move(actionToAssign), 0.0f);
 
     return Variable::ofNull();
 }
 
-Variable delayCommand(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable delayCommand(const ArgumentSpan &args, const RoutineContext &ctx) {
     float seconds = getFloat(args, 0);
     auto actionToDelay = getAction(args, 1);
 
-    // TODO: implement
+    ctx.game.delayCommand(getCaller(ctx)->id(), move(actionToDelay), seconds);
 
     return Variable::ofNull();
 }
 
-Variable executeScript(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable executeScript(const ArgumentSpan &args, const RoutineContext &ctx) {
     string script = getString(args, 0);
     auto target = getObject(args, 1, ctx);
     int scriptVar = getIntOrElse(args, 2, -1);
@@ -110,13 +110,13 @@ Variable executeScript(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable clearAllActions(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable clearAllActions(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofNull();
 }
 
-Variable setFacing(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setFacing(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto caller = getCaller(ctx);
     float direction = getFloat(args, 0);
 
@@ -125,13 +125,13 @@ Variable setFacing(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable switchPlayerCharacter(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable switchPlayerCharacter(const ArgumentSpan &args, const RoutineContext &ctx) {
     int npc = getInt(args, 0);
 
     throw NotImplementedException();
 }
 
-Variable setPartyLeader(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setPartyLeader(const ArgumentSpan &args, const RoutineContext &ctx) {
     int npc = getInt(args, 0);
 
     // TODO: implement
@@ -139,7 +139,7 @@ Variable setPartyLeader(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable setAreaUnescapable(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setAreaUnescapable(const ArgumentSpan &args, const RoutineContext &ctx) {
     bool unescapable = getIntAsBool(args, 0);
 
     // TODO: implement
@@ -147,34 +147,34 @@ Variable setAreaUnescapable(const vector<Variable> &args, const RoutineContext &
     return Variable::ofNull();
 }
 
-Variable getAreaUnescapable(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getAreaUnescapable(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getArea(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getArea(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getEnteringObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getEnteringObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto triggerrer = getTriggerrer(ctx);
     return Variable::ofObject(getObjectIdOrInvalid(triggerrer));
 }
 
-Variable getExitingObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getExitingObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto triggerrer = getTriggerrer(ctx);
     return Variable::ofObject(getObjectIdOrInvalid(triggerrer));
 }
 
-Variable getPosition(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getPosition(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target = getObject(args, 0, ctx);
     return Variable::ofVector(target->position());
 }
 
-Variable getFacing(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getFacing(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target = getObject(args, 0, ctx);
 
     float facing = glm::degrees(target->facing());
@@ -182,13 +182,13 @@ Variable getFacing(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofFloat(facing);
 }
 
-Variable getItemPossessor(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getItemPossessor(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getItemPossessedBy(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getItemPossessedBy(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
     string itemTag = boost::to_lower_copy(getString(args, 1));
 
@@ -197,7 +197,7 @@ Variable getItemPossessedBy(const vector<Variable> &args, const RoutineContext &
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable createItemOnObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable createItemOnObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     string itemTemplate = boost::to_lower_copy(getString(args, 0));
     auto target = getObjectOrCaller(args, 1, ctx);
     int stackSize = getIntOrElse(args, 2, 1);
@@ -208,7 +208,7 @@ Variable createItemOnObject(const vector<Variable> &args, const RoutineContext &
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getLastAttacker(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLastAttacker(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto attackee = getObjectOrCaller(args, 0, ctx);
 
     // TODO: implement
@@ -216,7 +216,7 @@ Variable getLastAttacker(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getNearestCreature(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getNearestCreature(const ArgumentSpan &args, const RoutineContext &ctx) {
     int firstCriteriaType = getInt(args, 0);
     int firstCriteriaValue = getInt(args, 1);
     auto target = getObjectOrCaller(args, 2, ctx);
@@ -231,7 +231,7 @@ Variable getNearestCreature(const vector<Variable> &args, const RoutineContext &
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getDistanceToObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getDistanceToObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto caller = getCaller(ctx);
     auto object = getObject(args, 0, ctx);
 
@@ -240,7 +240,7 @@ Variable getDistanceToObject(const vector<Variable> &args, const RoutineContext
     return Variable::ofFloat(0.0f);
 }
 
-Variable getIsObjectValid(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIsObjectValid(const ArgumentSpan &args, const RoutineContext &ctx) {
     throwIfOutOfRange(args, 0);
     throwIfUnexpectedType(VariableType::Object, args[0].type);
 
@@ -249,7 +249,7 @@ Variable getIsObjectValid(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofInt(R_FALSE);
 }
 
-Variable playSound(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable playSound(const ArgumentSpan &args, const RoutineContext &ctx) {
     string soundName = getString(args, 0);
 
     // TODO: implement
@@ -257,13 +257,13 @@ Variable playSound(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable getSpellTargetObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getSpellTargetObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getCurrentHitPoints(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getCurrentHitPoints(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObjectOrCaller(args, 0, ctx);
 
     // TODO: implement
@@ -271,7 +271,7 @@ Variable getCurrentHitPoints(const vector<Variable> &args, const RoutineContext
     return Variable::ofInt(0);
 }
 
-Variable getMaxHitPoints(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getMaxHitPoints(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObjectOrCaller(args, 0, ctx);
 
     // TODO: implement
@@ -279,35 +279,35 @@ Variable getMaxHitPoints(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofInt(0);
 }
 
-Variable getSubScreenID(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getSubScreenID(const ArgumentSpan &args, const RoutineContext &ctx) {
     throw NotImplementedException();
 }
 
-Variable cancelCombat(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable cancelCombat(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
 
     throw NotImplementedException();
 }
 
-Variable getCurrentForcePoints(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getCurrentForcePoints(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObjectOrCaller(args, 0, ctx);
 
     throw NotImplementedException();
 }
 
-Variable getMaxForcePoints(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getMaxForcePoints(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObjectOrCaller(args, 0, ctx);
 
     throw NotImplementedException();
 }
 
-Variable pauseGame(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable pauseGame(const ArgumentSpan &args, const RoutineContext &ctx) {
     bool pause = getIntAsBool(args, 0);
 
     throw NotImplementedException();
 }
 
-Variable setPlayerRestrictMode(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setPlayerRestrictMode(const ArgumentSpan &args, const RoutineContext &ctx) {
     bool restrict = getIntAsBool(args, 0);
 
     // TODO: implement
@@ -315,14 +315,14 @@ Variable setPlayerRestrictMode(const vector<Variable> &args, const RoutineContex
     return Variable::ofNull();
 }
 
-Variable getStringLength(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getStringLength(const ArgumentSpan &args, const RoutineContext &ctx) {
     string str = getString(args, 0);
     int result = str.length();
 
     return Variable::ofInt(static_cast<int>(result));
 }
 
-Variable getStringRight(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getStringRight(const ArgumentSpan &args, const RoutineContext &ctx) {
     string str = getString(args, 0);
     int count = getInt(args, 1);
 
@@ -334,7 +334,7 @@ Variable getStringRight(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofString(move(result));
 }
 
-Variable getStringLeft(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getStringLeft(const ArgumentSpan &args, const RoutineContext &ctx) {
     string str = getString(args, 0);
     int count = getInt(args, 1);
 
@@ -346,7 +346,7 @@ Variable getStringLeft(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofString(move(result));
 }
 
-Variable getSubString(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getSubString(const ArgumentSpan &args, const RoutineContext &ctx) {
     string str = getString(args, 0);
     int start = getInt(args, 1);
     int count = getInt(args, 2);
@@ -354,7 +354,7 @@ Variable getSubString(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofString(str.substr(start, count));
 }
 
-Variable findSubString(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable findSubString(const ArgumentSpan &args, const RoutineContext &ctx) {
     string str = getString(args, 0);
     string subString = getString(args, 1);
     size_t pos = str.find(subString);
@@ -362,14 +362,14 @@ Variable findSubString(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofInt(pos != string::npos ? static_cast<int>(pos) : -1);
 }
 
-Variable abs(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable abs(const ArgumentSpan &args, const RoutineContext &ctx) {
     int value = getInt(args, 0);
     int result = glm::abs(value);
 
     return Variable::ofInt(result);
 }
 
-Variable getPlayerRestrictMode(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getPlayerRestrictMode(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObjectOrCaller(args, 0, ctx);
 
     // TODO: implement
@@ -377,13 +377,13 @@ Variable getPlayerRestrictMode(const vector<Variable> &args, const RoutineContex
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getCasterLevel(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getCasterLevel(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
 
     throw NotImplementedException();
 }
 
-Variable getFirstEffect(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getFirstEffect(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -391,7 +391,7 @@ Variable getFirstEffect(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofEffect(nullptr);
 }
 
-Variable getNextEffect(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getNextEffect(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -399,7 +399,7 @@ Variable getNextEffect(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofEffect(nullptr);
 }
 
-Variable removeEffect(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable removeEffect(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
     auto effect = getEffect(args, 1);
 
@@ -408,7 +408,7 @@ Variable removeEffect(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable getIsEffectValid(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIsEffectValid(const ArgumentSpan &args, const RoutineContext &ctx) {
     throwIfOutOfRange(args, 0);
     throwIfUnexpectedType(VariableType::Effect, args[0].type);
 
@@ -417,7 +417,7 @@ Variable getIsEffectValid(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getEffectCreator(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getEffectCreator(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto effect = getEffect(args, 0);
 
     // TODO: implement
@@ -425,13 +425,13 @@ Variable getEffectCreator(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable intToString(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable intToString(const ArgumentSpan &args, const RoutineContext &ctx) {
     int integer = getInt(args, 0);
 
     return Variable::ofString(to_string(integer));
 }
 
-Variable getFirstObjectInArea(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getFirstObjectInArea(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto area = getObjectAsAreaOrCallerArea(args, 0, ctx);
     int objectFilter = getIntOrElse(args, 1, static_cast<int>(ObjectType::Creature));
 
@@ -440,7 +440,7 @@ Variable getFirstObjectInArea(const vector<Variable> &args, const RoutineContext
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getNextObjectInArea(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getNextObjectInArea(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto area = getObjectAsAreaOrCallerArea(args, 0, ctx);
     int objectFilter = getIntOrElse(args, 1, static_cast<int>(ObjectType::Creature));
 
@@ -449,7 +449,7 @@ Variable getNextObjectInArea(const vector<Variable> &args, const RoutineContext
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable d2(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable d2(const ArgumentSpan &args, const RoutineContext &ctx) {
     int numDice = glm::max(1, getIntOrElse(args, 0, 1));
     int result = 0;
 
@@ -460,7 +460,7 @@ Variable d2(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(result);
 }
 
-Variable d3(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable d3(const ArgumentSpan &args, const RoutineContext &ctx) {
     int numDice = glm::max(1, getIntOrElse(args, 0, 1));
     int result = 0;
 
@@ -471,7 +471,7 @@ Variable d3(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(result);
 }
 
-Variable d4(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable d4(const ArgumentSpan &args, const RoutineContext &ctx) {
     int numDice = glm::max(1, getIntOrElse(args, 0, 1));
     int result = 0;
 
@@ -482,7 +482,7 @@ Variable d4(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(result);
 }
 
-Variable d6(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable d6(const ArgumentSpan &args, const RoutineContext &ctx) {
     int numDice = glm::max(1, getIntOrElse(args, 0, 1));
     int result = 0;
 
@@ -493,7 +493,7 @@ Variable d6(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(result);
 }
 
-Variable d8(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable d8(const ArgumentSpan &args, const RoutineContext &ctx) {
     int numDice = glm::max(1, getIntOrElse(args, 0, 1));
     int result = 0;
 
@@ -504,7 +504,7 @@ Variable d8(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(result);
 }
 
-Variable d10(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable d10(const ArgumentSpan &args, const RoutineContext &ctx) {
     int numDice = glm::max(1, getIntOrElse(args, 0, 1));
     int result = 0;
 
@@ -515,7 +515,7 @@ Variable d10(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(result);
 }
 
-Variable d12(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable d12(const ArgumentSpan &args, const RoutineContext &ctx) {
     int numDice = glm::max(1, getIntOrElse(args, 0, 1));
     int result = 0;
 
@@ -526,7 +526,7 @@ Variable d12(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(result);
 }
 
-Variable d20(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable d20(const ArgumentSpan &args, const RoutineContext &ctx) {
     int numDice = glm::max(1, getIntOrElse(args, 0, 1));
     int result = 0;
 
@@ -537,7 +537,7 @@ Variable d20(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(result);
 }
 
-Variable d100(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable d100(const ArgumentSpan &args, const RoutineContext &ctx) {
     int numDice = glm::max(1, getIntOrElse(args, 0, 1));
     int result = 0;
 
@@ -548,16 +548,16 @@ Variable d100(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(result);
 }
 
-Variable getMetaMagicFeat(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getMetaMagicFeat(const ArgumentSpan &args, const RoutineContext &ctx) {
     throw NotImplementedException();
 }
 
-Variable getObjectType(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getObjectType(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target = getObject(args, 0, ctx);
     return Variable::ofInt(static_cast<int>(target->type()));
 }
 
-Variable getRacialType(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getRacialType(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -565,7 +565,7 @@ Variable getRacialType(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofInt(0);
 }
 
-Variable fortitudeSave(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable fortitudeSave(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
     auto saveType = getIntAsEnumOrElse(args, 1, SavingThrowType::None);
     auto saveVersus = getObjectOrCaller(args, 2, ctx);
@@ -573,7 +573,7 @@ Variable fortitudeSave(const vector<Variable> &args, const RoutineContext &ctx)
     throw NotImplementedException();
 }
 
-Variable reflexSave(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable reflexSave(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
     auto saveType = getIntAsEnumOrElse(args, 1, SavingThrowType::None);
     auto saveVersus = getObjectOrCaller(args, 2, ctx);
@@ -581,7 +581,7 @@ Variable reflexSave(const vector<Variable> &args, const RoutineContext &ctx) {
     throw NotImplementedException();
 }
 
-Variable willSave(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable willSave(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
     auto saveType = getIntAsEnumOrElse(args, 1, SavingThrowType::None);
     auto saveVersus = getObjectOrCaller(args, 2, ctx);
@@ -589,28 +589,28 @@ Variable willSave(const vector<Variable> &args, const RoutineContext &ctx) {
     throw NotImplementedException();
 }
 
-Variable getSpellSaveDC(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getSpellSaveDC(const ArgumentSpan &args, const RoutineContext &ctx) {
     throw NotImplementedException();
 }
 
-Variable roundsToSeconds(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable roundsToSeconds(const ArgumentSpan &args, const RoutineContext &ctx) {
     int rounds = getInt(args, 0);
     return Variable::ofFloat(rounds / 6.0f);
 }
 
-Variable hoursToSeconds(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable hoursToSeconds(const ArgumentSpan &args, const RoutineContext &ctx) {
     int hours = getInt(args, 0);
     return Variable::ofInt(hours * 3600);
 }
 
-Variable soundObjectSetFixedVariance(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable soundObjectSetFixedVariance(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto sound = getObjectAsSound(args, 0, ctx);
     float fixedVariance = getFloat(args, 1);
 
     throw NotImplementedException();
 }
 
-Variable getGoodEvilValue(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getGoodEvilValue(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -618,19 +618,19 @@ Variable getGoodEvilValue(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofInt(-1);
 }
 
-Variable getPartyMemberCount(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getPartyMemberCount(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofInt(0);
 }
 
-Variable getAlignmentGoodEvil(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getAlignmentGoodEvil(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
 
     throw NotImplementedException();
 }
 
-Variable getFirstObjectInShape(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getFirstObjectInShape(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto shape = getIntAsEnum<Shape>(args, 0);
     float size = getFloat(args, 1);
     auto target = getLocationArgument(args, 2);
@@ -641,7 +641,7 @@ Variable getFirstObjectInShape(const vector<Variable> &args, const RoutineContex
     throw NotImplementedException();
 }
 
-Variable getNextObjectInShape(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getNextObjectInShape(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto shape = getIntAsEnum<Shape>(args, 0);
     float size = getFloat(args, 1);
     auto target = getLocationArgument(args, 2);
@@ -652,7 +652,7 @@ Variable getNextObjectInShape(const vector<Variable> &args, const RoutineContext
     throw NotImplementedException();
 }
 
-Variable signalEvent(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable signalEvent(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
     auto evToRun = getEvent(args, 1);
 
@@ -661,7 +661,7 @@ Variable signalEvent(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable eventUserDefined(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable eventUserDefined(const ArgumentSpan &args, const RoutineContext &ctx) {
     int userDefinedEventNumber = getInt(args, 0);
 
     // TODO: implement
@@ -669,12 +669,12 @@ Variable eventUserDefined(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofEvent(nullptr);
 }
 
-Variable vectorNormalize(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable vectorNormalize(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto vector = getVector(args, 0);
     return Variable::ofVector(glm::normalize(vector));
 }
 
-Variable getItemStackSize(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getItemStackSize(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto item = getObjectAsItem(args, 0, ctx);
 
     // TODO: implement
@@ -682,7 +682,7 @@ Variable getItemStackSize(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofInt(0);
 }
 
-Variable getAbilityScore(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getAbilityScore(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
     auto abilityType = getIntAsEnum<Ability>(args, 1);
 
@@ -691,7 +691,7 @@ Variable getAbilityScore(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofInt(0);
 }
 
-Variable getIsDead(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIsDead(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -699,7 +699,7 @@ Variable getIsDead(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(R_FALSE);
 }
 
-Variable vectorCreate(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable vectorCreate(const ArgumentSpan &args, const RoutineContext &ctx) {
     float x = getFloatOrElse(args, 0, 0.0f);
     float y = getFloatOrElse(args, 1, 0.0f);
     float z = getFloatOrElse(args, 2, 0.0f);
@@ -707,7 +707,7 @@ Variable vectorCreate(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofVector(glm::vec3(x, y, z));
 }
 
-Variable setFacingPoint(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setFacingPoint(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto caller = getCaller(ctx);
     auto target = getVector(args, 0);
 
@@ -716,14 +716,14 @@ Variable setFacingPoint(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable angleToVector(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable angleToVector(const ArgumentSpan &args, const RoutineContext &ctx) {
     float angle = glm::radians(getFloat(args, 0));
     auto vector = glm::vec3(glm::cos(angle), glm::sin(angle), 0.0f);
 
     return Variable::ofVector(move(vector));
 }
 
-Variable setItemStackSize(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setItemStackSize(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto item = getObjectAsItem(args, 0, ctx);
     int stackSize = glm::max(1, getInt(args, 1));
 
@@ -732,7 +732,7 @@ Variable setItemStackSize(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofNull();
 }
 
-Variable getDistanceBetween(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getDistanceBetween(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto objectA = getObject(args, 0, ctx);
     auto objectB = getObject(args, 1, ctx);
 
@@ -741,7 +741,7 @@ Variable getDistanceBetween(const vector<Variable> &args, const RoutineContext &
     return Variable::ofFloat(0.0f);
 }
 
-Variable setReturnStrref(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setReturnStrref(const ArgumentSpan &args, const RoutineContext &ctx) {
     bool show = getIntAsBool(args, 0);
     int stringRef = getIntOrElse(args, 1, 0);
     int returnQueryStrRef = getIntOrElse(args, 1, 0);
@@ -751,7 +751,7 @@ Variable setReturnStrref(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofNull();
 }
 
-Variable getItemInSlot(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getItemInSlot(const ArgumentSpan &args, const RoutineContext &ctx) {
     int slot = getInt(args, 0);
     auto creature = getObjectOrCallerAsCreature(args, 1, ctx);
 
@@ -760,7 +760,7 @@ Variable getItemInSlot(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable setGlobalString(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setGlobalString(const ArgumentSpan &args, const RoutineContext &ctx) {
     string identifier = getString(args, 0);
     string value = getString(args, 1);
 
@@ -769,7 +769,7 @@ Variable setGlobalString(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofNull();
 }
 
-Variable setCommandable(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setCommandable(const ArgumentSpan &args, const RoutineContext &ctx) {
     bool commandable = getIntAsBool(args, 0);
     auto target = getObjectOrCaller(args, 1, ctx);
 
@@ -778,7 +778,7 @@ Variable setCommandable(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable getCommandable(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getCommandable(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target = getObjectOrCaller(args, 0, ctx);
 
     // TODO: implement
@@ -786,7 +786,7 @@ Variable getCommandable(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getHitDice(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getHitDice(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -794,12 +794,12 @@ Variable getHitDice(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(0);
 }
 
-Variable getTag(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getTag(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
     return Variable::ofString(object->tag());
 }
 
-Variable resistForce(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable resistForce(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto source = getObject(args, 0, ctx);
     auto target = getObject(args, 1, ctx);
 
@@ -808,7 +808,7 @@ Variable resistForce(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable getEffectType(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getEffectType(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto effect = getEffect(args, 0);
 
     // TODO: implement
@@ -816,7 +816,7 @@ Variable getEffectType(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofInt(0);
 }
 
-Variable getFactionEqual(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getFactionEqual(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto firstObject = getObjectAsCreature(args, 0, ctx);
     auto secondObject = getObjectOrCallerAsCreature(args, 1, ctx);
 
@@ -825,7 +825,7 @@ Variable getFactionEqual(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofInt(R_FALSE);
 }
 
-Variable setListening(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setListening(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
     bool value = getIntAsBool(args, 1);
 
@@ -834,7 +834,7 @@ Variable setListening(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable setListenPattern(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setListenPattern(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
     string pattern = getString(args, 1);
     int number = getIntOrElse(args, 2, 0);
@@ -844,7 +844,7 @@ Variable setListenPattern(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofNull();
 }
 
-Variable getFactionAverageReputation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getFactionAverageReputation(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto sourceFactionMember = getObject(args, 0, ctx);
     auto target = getObject(args, 1, ctx);
 
@@ -853,7 +853,7 @@ Variable getFactionAverageReputation(const vector<Variable> &args, const Routine
     return Variable::ofInt(-1);
 }
 
-Variable getGlobalString(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getGlobalString(const ArgumentSpan &args, const RoutineContext &ctx) {
     string identifier = getString(args, 0);
 
     // TODO: implement
@@ -861,13 +861,13 @@ Variable getGlobalString(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofString("");
 }
 
-Variable getListenPatternNumber(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getListenPatternNumber(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofInt(-1);
 }
 
-Variable getWaypointByTag(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getWaypointByTag(const ArgumentSpan &args, const RoutineContext &ctx) {
     string waypointTag = boost::to_lower_copy(getString(args, 0));
 
     // TODO: implement
@@ -875,16 +875,16 @@ Variable getWaypointByTag(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getObjectByTag(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getObjectByTag(const ArgumentSpan &args, const RoutineContext &ctx) {
     string tag = boost::to_lower_copy(getString(args, 0));
     int nth = getIntOrElse(args, 1, 0);
 
-    // TODO: implement
+    auto object = ctx.game.objectByTag(tag, nth);
 
-    return Variable::ofObject(kObjectInvalid);
+    return Variable::ofObject(getObjectIdOrInvalid(object));
 }
 
-Variable adjustAlignment(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable adjustAlignment(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto subject = getObject(args, 0, ctx);
     auto alignment = getIntAsEnum<Alignment>(args, 1);
 
@@ -893,7 +893,7 @@ Variable adjustAlignment(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofNull();
 }
 
-Variable getReputation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getReputation(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto source = getObject(args, 0, ctx);
     auto target = getObject(args, 1, ctx);
 
@@ -902,7 +902,7 @@ Variable getReputation(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofInt(-1);
 }
 
-Variable adjustReputation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable adjustReputation(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target = getObject(args, 0, ctx);
     auto sourceFactionMember = getObject(args, 1, ctx);
     auto adjustment = getInt(args, 2);
@@ -912,11 +912,11 @@ Variable adjustReputation(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofNull();
 }
 
-Variable getModuleFileName(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getModuleFileName(const ArgumentSpan &args, const RoutineContext &ctx) {
     throw NotImplementedException();
 }
 
-Variable getLocation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLocation(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
 
     // TODO: implement
@@ -924,7 +924,7 @@ Variable getLocation(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofLocation(nullptr);
 }
 
-Variable location(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable location(const ArgumentSpan &args, const RoutineContext &ctx) {
     glm::vec3 position(getVector(args, 0));
     float orientation = glm::radians(getFloat(args, 1));
 
@@ -933,7 +933,7 @@ Variable location(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofLocation(nullptr);
 }
 
-Variable applyEffectAtLocation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable applyEffectAtLocation(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto durationType = getIntAsEnum<DurationType>(args, 0);
     auto effect = getEffect(args, 1);
     auto location = getLocationArgument(args, 2);
@@ -944,7 +944,7 @@ Variable applyEffectAtLocation(const vector<Variable> &args, const RoutineContex
     return Variable::ofNull();
 }
 
-Variable getIsPC(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIsPC(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -952,7 +952,7 @@ Variable getIsPC(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(R_FALSE);
 }
 
-Variable applyEffectToObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable applyEffectToObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto durationType = getIntAsEnum<DurationType>(args, 0);
     auto effect = getEffect(args, 1);
     auto target = getObject(args, 2, ctx);
@@ -963,7 +963,7 @@ Variable applyEffectToObject(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable speakString(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable speakString(const ArgumentSpan &args, const RoutineContext &ctx) {
     string stringToSpeak = getString(args, 0);
     auto talkVolume = getIntAsEnumOrElse(args, 1, TalkVolume::Talk);
 
@@ -972,11 +972,11 @@ Variable speakString(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable getSpellTargetLocation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getSpellTargetLocation(const ArgumentSpan &args, const RoutineContext &ctx) {
     throw NotImplementedException();
 }
 
-Variable getPositionFromLocation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getPositionFromLocation(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto location = getLocationArgument(args, 0);
 
     // TODO: implement
@@ -984,7 +984,7 @@ Variable getPositionFromLocation(const vector<Variable> &args, const RoutineCont
     return Variable::ofVector(glm::vec3(0.0f));
 }
 
-Variable getFacingFromLocation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getFacingFromLocation(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto location = getLocationArgument(args, 0);
 
     // TODO: implement
@@ -992,37 +992,41 @@ Variable getFacingFromLocation(const vector<Variable> &args, const RoutineContex
     return Variable::ofFloat(-1.0f);
 }
 
-Variable getNearestObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getNearestObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto objectType = getIntAsEnumOrElse(args, 0, ObjectType::All);
     auto target = getObjectOrCaller(args, 1, ctx);
     int nth = getIntOrElse(args, 2, 1);
 
-    // TODO: implement
+    auto object = ctx.game.nearestObject(glm::vec2(target->position()), nth - 1, [&](auto &object) {
+        return &object != target && (static_cast<int>(objectType) & static_cast<int>(object.type())) != 0;
+    });
 
-    return Variable::ofObject(kObjectInvalid);
+    return Variable::ofObject(getObjectIdOrInvalid(object));
 }
 
-Variable getNearestObjectByTag(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getNearestObjectByTag(const ArgumentSpan &args, const RoutineContext &ctx) {
     string tag = boost::to_lower_copy(getString(args, 0));
     auto target = getObjectOrCaller(args, 1, ctx);
     int nth = getIntOrElse(args, 2, 1);
 
-    // TODO: implement
+    auto object = ctx.game.nearestObject(glm::vec2(target->position()), nth - 1, [&](auto &object) {
+        return &object != target && boost::iequals(object.tag(), tag);
+    });
 
-    return Variable::ofObject(kObjectInvalid);
+    return Variable::ofObject(getObjectIdOrInvalid(object));
 }
 
-Variable intToFloat(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable intToFloat(const ArgumentSpan &args, const RoutineContext &ctx) {
     int integer = getInt(args, 0);
     return Variable::ofFloat(static_cast<float>(integer));
 }
 
-Variable floatToInt(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable floatToInt(const ArgumentSpan &args, const RoutineContext &ctx) {
     float value = getFloat(args, 0);
     return Variable::ofInt(static_cast<int>(value));
 }
 
-Variable stringToInt(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable stringToInt(const ArgumentSpan &args, const RoutineContext &ctx) {
     string number = getString(args, 0);
 
     int result = 0;
@@ -1033,7 +1037,7 @@ Variable stringToInt(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(result);
 }
 
-Variable getIsEnemy(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIsEnemy(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target = getObjectAsCreature(args, 0, ctx);
     auto source = getObjectOrCallerAsCreature(args, 1, ctx);
 
@@ -1042,7 +1046,7 @@ Variable getIsEnemy(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getIsFriend(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIsFriend(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target = getObjectAsCreature(args, 0, ctx);
     auto source = getObjectOrCallerAsCreature(args, 1, ctx);
 
@@ -1051,7 +1055,7 @@ Variable getIsFriend(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getIsNeutral(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIsNeutral(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target = getObjectAsCreature(args, 0, ctx);
     auto source = getObjectOrCallerAsCreature(args, 1, ctx);
 
@@ -1060,20 +1064,20 @@ Variable getIsNeutral(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getPCSpeaker(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getPCSpeaker(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getStringByStrRef(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getStringByStrRef(const ArgumentSpan &args, const RoutineContext &ctx) {
     int strRef = getInt(args, 0);
     string result = ctx.services.resource.strings.get(strRef);
 
     return Variable::ofString(move(result));
 }
 
-Variable destroyObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable destroyObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto destroy = getObject(args, 0, ctx);
     float delay = getFloatOrElse(args, 1, 0.0f);
     bool noFade = getIntAsBoolOrElse(args, 2, false);
@@ -1085,13 +1089,13 @@ Variable destroyObject(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable getModule(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getModule(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable createObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable createObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto objectType = getIntAsEnum<ObjectType>(args, 0);
     string tmplt = boost::to_lower_copy(getString(args, 1));
     auto location = getLocationArgument(args, 2);
@@ -1102,7 +1106,7 @@ Variable createObject(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable eventSpellCastAt(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable eventSpellCastAt(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto caster = getObject(args, 0, ctx);
     int spell = getInt(args, 1);
     bool harmful = getIntAsBoolOrElse(args, 2, true);
@@ -1110,31 +1114,31 @@ Variable eventSpellCastAt(const vector<Variable> &args, const RoutineContext &ct
     throw NotImplementedException();
 }
 
-Variable getLastSpellCaster(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLastSpellCaster(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getLastSpell(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLastSpell(const ArgumentSpan &args, const RoutineContext &ctx) {
     throw NotImplementedException();
 }
 
-Variable getUserDefinedEventNumber(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getUserDefinedEventNumber(const ArgumentSpan &args, const RoutineContext &ctx) {
     return Variable::ofInt(ctx.execution.userDefinedEventNumber);
 }
 
-Variable getSpellId(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getSpellId(const ArgumentSpan &args, const RoutineContext &ctx) {
     throw NotImplementedException();
 }
 
-Variable getLoadFromSaveGame(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLoadFromSaveGame(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofInt(static_cast<int>(false));
 }
 
-Variable getName(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getName(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
 
     // TODO: implement
@@ -1142,20 +1146,20 @@ Variable getName(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofString("");
 }
 
-Variable getLastSpeaker(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLastSpeaker(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable beginConversation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable beginConversation(const ArgumentSpan &args, const RoutineContext &ctx) {
     string resRef = boost::to_lower_copy(getStringOrElse(args, 0, ""));
     auto objectToDialog = getObjectOrNull(args, 1, ctx);
 
     throw NotImplementedException();
 }
 
-Variable getLastPerceived(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLastPerceived(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto caller = getCallerAsCreature(ctx);
 
     // TODO: implement
@@ -1163,7 +1167,7 @@ Variable getLastPerceived(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getLastPerceptionSeen(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLastPerceptionSeen(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto caller = getCallerAsCreature(ctx);
 
     // TODO: implement
@@ -1171,12 +1175,12 @@ Variable getLastPerceptionSeen(const vector<Variable> &args, const RoutineContex
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getLastClosedBy(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLastClosedBy(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto triggerrer = getTriggerrer(ctx);
     return Variable::ofObject(getObjectIdOrInvalid(triggerrer));
 }
 
-Variable getLastPerceptionVanished(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLastPerceptionVanished(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto caller = getCallerAsCreature(ctx);
 
     // TODO: implement
@@ -1184,7 +1188,7 @@ Variable getLastPerceptionVanished(const vector<Variable> &args, const RoutineCo
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getFirstInPersistentObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getFirstInPersistentObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto persistentObject = getObjectOrCaller(args, 0, ctx);
     auto residentObjectType = getIntAsEnumOrElse(args, 1, ObjectType::Creature);
     auto persistentZone = getIntAsEnumOrElse(args, 2, PersistentZone::Active);
@@ -1194,7 +1198,7 @@ Variable getFirstInPersistentObject(const vector<Variable> &args, const RoutineC
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getNextInPersistentObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getNextInPersistentObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto persistentObject = getObjectOrCaller(args, 0, ctx);
     auto residentObjectType = getIntAsEnumOrElse(args, 1, ObjectType::Creature);
     auto persistentZone = getIntAsEnumOrElse(args, 2, PersistentZone::Active);
@@ -1204,13 +1208,13 @@ Variable getNextInPersistentObject(const vector<Variable> &args, const RoutineCo
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable showLevelUpGUI(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable showLevelUpGUI(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofInt(R_FALSE);
 }
 
-Variable setItemNonEquippable(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setItemNonEquippable(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto item = getObjectAsItem(args, 0, ctx);
     bool nonEquippable = getIntAsBool(args, 1);
 
@@ -1219,7 +1223,7 @@ Variable setItemNonEquippable(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable setButtonMashCheck(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setButtonMashCheck(const ArgumentSpan &args, const RoutineContext &ctx) {
     bool check = getIntAsBool(args, 0);
 
     // TODO: implement
@@ -1227,7 +1231,7 @@ Variable setButtonMashCheck(const vector<Variable> &args, const RoutineContext &
     return Variable::ofNull();
 }
 
-Variable giveItem(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable giveItem(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto item = getObjectAsItem(args, 0, ctx);
     auto giveTo = getObject(args, 1, ctx);
 
@@ -1236,14 +1240,14 @@ Variable giveItem(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable objectToString(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable objectToString(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
     string result = str(boost::format("%x") % object->id());
 
     return Variable::ofString(move(result));
 }
 
-Variable getIsImmune(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIsImmune(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
     auto immunityType = getIntAsEnum<ImmunityType>(args, 1);
     auto versus = getObject(args, 2, ctx);
@@ -1253,13 +1257,13 @@ Variable getIsImmune(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getModuleItemAcquired(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getModuleItemAcquired(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getEncounterActive(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getEncounterActive(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto encounter = getObject(args, 0, ctx);
 
     // TODO: implement
@@ -1267,7 +1271,7 @@ Variable getEncounterActive(const vector<Variable> &args, const RoutineContext &
     return Variable::ofInt(R_FALSE);
 }
 
-Variable setEncounterActive(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setEncounterActive(const ArgumentSpan &args, const RoutineContext &ctx) {
     bool newValue = getIntAsBool(args, 0);
     auto encounter = getObject(args, 1, ctx);
 
@@ -1276,7 +1280,7 @@ Variable setEncounterActive(const vector<Variable> &args, const RoutineContext &
     return Variable::ofNull();
 }
 
-Variable setCustomToken(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setCustomToken(const ArgumentSpan &args, const RoutineContext &ctx) {
     int customTokenNumber = getInt(args, 0);
     string tokenValue = getString(args, 1);
 
@@ -1285,7 +1289,7 @@ Variable setCustomToken(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable getHasFeat(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getHasFeat(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto feat = getIntAsEnum<FeatType>(args, 0);
     auto creature = getObjectOrCallerAsCreature(args, 1, ctx);
 
@@ -1294,7 +1298,7 @@ Variable getHasFeat(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getHasSkill(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getHasSkill(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectOrCallerAsCreature(args, 1, ctx);
     auto skill = getIntAsEnum<SkillType>(args, 0);
 
@@ -1303,7 +1307,7 @@ Variable getHasSkill(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getObjectSeen(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getObjectSeen(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target = getObjectAsCreature(args, 0, ctx);
     auto source = getObjectOrCallerAsCreature(args, 1, ctx);
 
@@ -1312,13 +1316,13 @@ Variable getObjectSeen(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getLastPlayerDied(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLastPlayerDied(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getReflexAdjustedDamage(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getReflexAdjustedDamage(const ArgumentSpan &args, const RoutineContext &ctx) {
     int damage = getInt(args, 0);
     auto target = getObject(args, 1, ctx);
     int dc = getInt(args, 2);
@@ -1330,7 +1334,7 @@ Variable getReflexAdjustedDamage(const vector<Variable> &args, const RoutineCont
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable playAnimation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable playAnimation(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto caller = getCaller(ctx);
     auto animType = getIntAsEnum<AnimationType>(args, 0);
     float speed = getFloatOrElse(args, 1, 1.0f);
@@ -1341,7 +1345,7 @@ Variable playAnimation(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable talentSpell(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable talentSpell(const ArgumentSpan &args, const RoutineContext &ctx) {
     int spell = getInt(args, 0);
 
     // TODO: implement
@@ -1349,7 +1353,7 @@ Variable talentSpell(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofTalent(nullptr);
 }
 
-Variable talentFeat(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable talentFeat(const ArgumentSpan &args, const RoutineContext &ctx) {
     int feat = getInt(args, 0);
 
     // TODO: implement
@@ -1357,7 +1361,7 @@ Variable talentFeat(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofTalent(nullptr);
 }
 
-Variable getHasSpellEffect(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getHasSpellEffect(const ArgumentSpan &args, const RoutineContext &ctx) {
     int spell = getInt(args, 0);
     auto object = getObjectOrCaller(args, 1, ctx);
 
@@ -1366,7 +1370,7 @@ Variable getHasSpellEffect(const vector<Variable> &args, const RoutineContext &c
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getEffectSpellId(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getEffectSpellId(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto effect = getEffect(args, 0);
 
     // TODO: implement
@@ -1374,7 +1378,7 @@ Variable getEffectSpellId(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofInt(-1);
 }
 
-Variable getCreatureHasTalent(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getCreatureHasTalent(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto talent = getTalent(args, 0);
     auto creature = getObjectOrCallerAsCreature(args, 1, ctx);
 
@@ -1383,7 +1387,7 @@ Variable getCreatureHasTalent(const vector<Variable> &args, const RoutineContext
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getCreatureTalentRandom(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getCreatureTalentRandom(const ArgumentSpan &args, const RoutineContext &ctx) {
     int category = getInt(args, 0);
     auto creature = getObjectOrCallerAsCreature(args, 1, ctx);
     int inclusion = getIntOrElse(args, 2, 0);
@@ -1393,7 +1397,7 @@ Variable getCreatureTalentRandom(const vector<Variable> &args, const RoutineCont
     return Variable::ofTalent(nullptr);
 }
 
-Variable getCreatureTalentBest(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getCreatureTalentBest(const ArgumentSpan &args, const RoutineContext &ctx) {
     int category = getInt(args, 0);
     int crMax = getInt(args, 1);
     auto creature = getObjectOrCallerAsCreature(args, 2, ctx);
@@ -1406,7 +1410,7 @@ Variable getCreatureTalentBest(const vector<Variable> &args, const RoutineContex
     return Variable::ofTalent(nullptr);
 }
 
-Variable jumpToLocation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable jumpToLocation(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto destination = getLocationArgument(args, 0);
 
     // TODO: implement
@@ -1414,7 +1418,7 @@ Variable jumpToLocation(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable getSkillRank(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getSkillRank(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObjectOrCallerAsCreature(args, 1, ctx);
     auto skill = getIntAsEnum<SkillType>(args, 0);
 
@@ -1423,7 +1427,7 @@ Variable getSkillRank(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(0);
 }
 
-Variable getAttackTarget(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getAttackTarget(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectOrCallerAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -1431,7 +1435,7 @@ Variable getAttackTarget(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getDistanceBetween2D(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getDistanceBetween2D(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto objectA = getObject(args, 0, ctx);
     auto objectB = getObject(args, 1, ctx);
 
@@ -1440,7 +1444,7 @@ Variable getDistanceBetween2D(const vector<Variable> &args, const RoutineContext
     return Variable::ofFloat(0.0f);
 }
 
-Variable getIsInCombat(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIsInCombat(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectOrCallerAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -1448,7 +1452,7 @@ Variable getIsInCombat(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofInt(R_FALSE);
 }
 
-Variable giveGoldToCreature(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable giveGoldToCreature(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
     auto gp = getInt(args, 1);
 
@@ -1457,7 +1461,7 @@ Variable giveGoldToCreature(const vector<Variable> &args, const RoutineContext &
     return Variable::ofNull();
 }
 
-Variable setIsDestroyable(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setIsDestroyable(const ArgumentSpan &args, const RoutineContext &ctx) {
     bool destroyabe = getIntAsBool(args, 0);
     bool raiseable = getIntAsBoolOrElse(args, 1, true);
     bool selectableWhenDead = getIntAsBoolOrElse(args, 2, false);
@@ -1467,7 +1471,7 @@ Variable setIsDestroyable(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofNull();
 }
 
-Variable setLocked(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setLocked(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target = getObjectAsDoor(args, 0, ctx);
     bool locked = getIntAsBool(args, 1);
 
@@ -1476,7 +1480,7 @@ Variable setLocked(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable getLocked(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLocked(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target = getObjectAsDoor(args, 0, ctx);
 
     // TODO: implement
@@ -1484,7 +1488,7 @@ Variable getLocked(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getLastWeaponUsed(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLastWeaponUsed(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -1492,13 +1496,13 @@ Variable getLastWeaponUsed(const vector<Variable> &args, const RoutineContext &c
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getLastUsedBy(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLastUsedBy(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getAbilityModifier(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getAbilityModifier(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto ability = getIntAsEnum<Ability>(args, 0);
     auto creature = getObjectAsCreature(args, 1, ctx);
 
@@ -1507,7 +1511,7 @@ Variable getAbilityModifier(const vector<Variable> &args, const RoutineContext &
     return Variable::ofInt(0);
 }
 
-Variable getDistanceToObject2D(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getDistanceToObject2D(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
 
     // TODO: implement
@@ -1515,13 +1519,13 @@ Variable getDistanceToObject2D(const vector<Variable> &args, const RoutineContex
     return Variable::ofFloat(0.0f);
 }
 
-Variable getBlockingDoor(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getBlockingDoor(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getIsDoorActionPossible(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIsDoorActionPossible(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto targetDoor = getObjectAsDoor(args, 0, ctx);
     auto doorAction = getIntAsEnum<DoorAction>(args, 1);
 
@@ -1530,7 +1534,7 @@ Variable getIsDoorActionPossible(const vector<Variable> &args, const RoutineCont
     return Variable::ofInt(R_FALSE);
 }
 
-Variable doDoorAction(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable doDoorAction(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto targetDoor = getObjectAsDoor(args, 0, ctx);
     auto doorAction = getIntAsEnum<DoorAction>(args, 1);
 
@@ -1539,7 +1543,7 @@ Variable doDoorAction(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable getFirstItemInInventory(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getFirstItemInInventory(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target = getObjectOrCaller(args, 0, ctx);
 
     // TODO: implement
@@ -1547,7 +1551,7 @@ Variable getFirstItemInInventory(const vector<Variable> &args, const RoutineCont
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getNextItemInInventory(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getNextItemInInventory(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target = getObjectOrCaller(args, 0, ctx);
 
     // TODO: implement
@@ -1555,7 +1559,7 @@ Variable getNextItemInInventory(const vector<Variable> &args, const RoutineConte
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getClassByPosition(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getClassByPosition(const ArgumentSpan &args, const RoutineContext &ctx) {
     int classPosition = getInt(args, 0);
     auto creature = getObjectOrCallerAsCreature(args, 1, ctx);
 
@@ -1564,7 +1568,7 @@ Variable getClassByPosition(const vector<Variable> &args, const RoutineContext &
     return Variable::ofInt(0);
 }
 
-Variable getLevelByPosition(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLevelByPosition(const ArgumentSpan &args, const RoutineContext &ctx) {
     int classPosition = getInt(args, 0);
     auto creature = getObjectOrCallerAsCreature(args, 1, ctx);
 
@@ -1573,7 +1577,7 @@ Variable getLevelByPosition(const vector<Variable> &args, const RoutineContext &
     return Variable::ofInt(0);
 }
 
-Variable getLevelByClass(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLevelByClass(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto classType = getIntAsEnum<ClassType>(args, 0);
     auto creature = getObjectOrCallerAsCreature(args, 1, ctx);
 
@@ -1582,7 +1586,7 @@ Variable getLevelByClass(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofInt(0);
 }
 
-Variable getDamageDealtByType(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getDamageDealtByType(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto damageType = getIntAsEnum<DamageType>(args, 0);
 
     // TODO: implement
@@ -1590,29 +1594,29 @@ Variable getDamageDealtByType(const vector<Variable> &args, const RoutineContext
     return Variable::ofInt(0);
 }
 
-Variable getTotalDamageDealt(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getTotalDamageDealt(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofInt(0);
 }
 
-Variable getLastDamager(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLastDamager(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getInventoryDisturbType(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getInventoryDisturbType(const ArgumentSpan &args, const RoutineContext &ctx) {
     throw NotImplementedException();
 }
 
-Variable getInventoryDisturbItem(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getInventoryDisturbItem(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable showUpgradeScreen(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable showUpgradeScreen(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto item = getObjectAsItemOrNull(args, 0, ctx);
     auto character = getObjectOrNull(args, 1, ctx);
     bool disableItemCreation = getIntAsBoolOrElse(args, 2, false);
@@ -1624,7 +1628,7 @@ Variable showUpgradeScreen(const vector<Variable> &args, const RoutineContext &c
     return Variable::ofNull();
 }
 
-Variable getGender(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getGender(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -1632,14 +1636,14 @@ Variable getGender(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(0);
 }
 
-Variable getIsTalentValid(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIsTalentValid(const ArgumentSpan &args, const RoutineContext &ctx) {
     throwIfOutOfRange(args, 0);
     throwIfUnexpectedType(VariableType::Talent, args[0].type);
     auto talent = static_pointer_cast<Talent>(args[0].engineType);
     return Variable::ofInt(static_cast<int>(talent && talent->type() != TalentType::Invalid));
 }
 
-Variable getAttemptedAttackTarget(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getAttemptedAttackTarget(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto caller = getCallerAsCreature(ctx);
 
     // TODO: implement
@@ -1647,17 +1651,17 @@ Variable getAttemptedAttackTarget(const vector<Variable> &args, const RoutineCon
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getTypeFromTalent(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getTypeFromTalent(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto talent = getTalent(args, 0);
     return Variable::ofInt(static_cast<int>(talent->type()));
 }
 
-Variable getIdFromTalent(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIdFromTalent(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto talent = getTalent(args, 0);
     throw NotImplementedException();
 }
 
-Variable playPazaak(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable playPazaak(const ArgumentSpan &args, const RoutineContext &ctx) {
     int opponentPazaakDeck = getInt(args, 0);
     string endScript = getString(args, 1);
     int maxWager = getInt(args, 2);
@@ -1669,13 +1673,13 @@ Variable playPazaak(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable getLastPazaakResult(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLastPazaakResult(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofInt(0);
 }
 
-Variable displayFeedBackText(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable displayFeedBackText(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
     int textConstant = getInt(args, 1);
 
@@ -1684,7 +1688,7 @@ Variable displayFeedBackText(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable addJournalQuestEntry(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable addJournalQuestEntry(const ArgumentSpan &args, const RoutineContext &ctx) {
     string plotId = getString(args, 0);
     int state = getInt(args, 1);
     bool allowOverrideHigher = getIntAsBoolOrElse(args, 2, false);
@@ -1694,7 +1698,7 @@ Variable addJournalQuestEntry(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable removeJournalQuestEntry(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable removeJournalQuestEntry(const ArgumentSpan &args, const RoutineContext &ctx) {
     string plotId = getString(args, 0);
 
     // TODO: implement
@@ -1702,7 +1706,7 @@ Variable removeJournalQuestEntry(const vector<Variable> &args, const RoutineCont
     return Variable::ofNull();
 }
 
-Variable getJournalEntry(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getJournalEntry(const ArgumentSpan &args, const RoutineContext &ctx) {
     string plotId = getString(args, 0);
 
     // TODO: implement
@@ -1710,7 +1714,7 @@ Variable getJournalEntry(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofInt(0);
 }
 
-Variable playRumblePattern(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable playRumblePattern(const ArgumentSpan &args, const RoutineContext &ctx) {
     int pattern = getInt(args, 0);
 
     // TODO: implement
@@ -1718,7 +1722,7 @@ Variable playRumblePattern(const vector<Variable> &args, const RoutineContext &c
     return Variable::ofNull();
 }
 
-Variable stopRumblePattern(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable stopRumblePattern(const ArgumentSpan &args, const RoutineContext &ctx) {
     int pattern = getInt(args, 0);
 
     // TODO: implement
@@ -1726,7 +1730,7 @@ Variable stopRumblePattern(const vector<Variable> &args, const RoutineContext &c
     return Variable::ofNull();
 }
 
-Variable getAttemptedSpellTarget(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getAttemptedSpellTarget(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto caller = getCallerAsCreature(ctx);
 
     // TODO: implement
@@ -1734,12 +1738,12 @@ Variable getAttemptedSpellTarget(const vector<Variable> &args, const RoutineCont
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getLastOpenedBy(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLastOpenedBy(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto triggerrer = getTriggerrer(ctx);
     return Variable::ofObject(getObjectIdOrInvalid(triggerrer));
 }
 
-Variable getHasSpell(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getHasSpell(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto spell = getIntAsEnum<SpellType>(args, 0);
     auto creature = getObjectOrCallerAsCreature(args, 1, ctx);
 
@@ -1748,7 +1752,7 @@ Variable getHasSpell(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(R_FALSE);
 }
 
-Variable openStore(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable openStore(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto store = getObject(args, 0, ctx);
     auto pc = getObject(args, 1, ctx);
     int bonusMarkUp = getIntOrElse(args, 2, 0);
@@ -1759,7 +1763,7 @@ Variable openStore(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable jumpToObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable jumpToObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto toJumpTo = getObject(args, 0, ctx);
     bool walkStraightLineToPoint = getIntAsBoolOrElse(args, 1, true);
 
@@ -1768,7 +1772,7 @@ Variable jumpToObject(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable setMapPinEnabled(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setMapPinEnabled(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto mapPin = getObject(args, 0, ctx);
     bool enabled = getIntAsBool(args, 1);
 
@@ -1777,7 +1781,7 @@ Variable setMapPinEnabled(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofNull();
 }
 
-Variable addMultiClass(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable addMultiClass(const ArgumentSpan &args, const RoutineContext &ctx) {
     int classType = getInt(args, 0);
     auto source = getObject(args, 1, ctx);
 
@@ -1786,7 +1790,7 @@ Variable addMultiClass(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable getIsLinkImmune(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIsLinkImmune(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target = getObject(args, 0, ctx);
     auto effect = getEffect(args, 1);
 
@@ -1795,7 +1799,7 @@ Variable getIsLinkImmune(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofInt(R_FALSE);
 }
 
-Variable giveXPToCreature(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable giveXPToCreature(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
     int xpAmount = getInt(args, 1);
 
@@ -1804,7 +1808,7 @@ Variable giveXPToCreature(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofNull();
 }
 
-Variable setXP(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setXP(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
     int xpAmount = getInt(args, 1);
 
@@ -1813,7 +1817,7 @@ Variable setXP(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable getXP(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getXP(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -1821,7 +1825,7 @@ Variable getXP(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(0);
 }
 
-Variable getBaseItemType(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getBaseItemType(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto item = getObjectAsItem(args, 0, ctx);
 
     // TODO: implement
@@ -1829,7 +1833,7 @@ Variable getBaseItemType(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofInt(0);
 }
 
-Variable getItemHasItemProperty(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getItemHasItemProperty(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto item = getObjectAsItem(args, 0, ctx);
     auto property = getIntAsEnum<ItemProperty>(args, 1);
 
@@ -1838,7 +1842,7 @@ Variable getItemHasItemProperty(const vector<Variable> &args, const RoutineConte
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getIsEncounterCreature(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIsEncounterCreature(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectOrCallerAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -1846,7 +1850,7 @@ Variable getIsEncounterCreature(const vector<Variable> &args, const RoutineConte
     return Variable::ofInt(R_FALSE);
 }
 
-Variable changeToStandardFaction(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable changeToStandardFaction(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creatureToChange = getObjectAsCreature(args, 0, ctx);
     auto standardFaction = getIntAsEnum<Faction>(args, 1);
 
@@ -1855,7 +1859,7 @@ Variable changeToStandardFaction(const vector<Variable> &args, const RoutineCont
     return Variable::ofNull();
 }
 
-Variable soundObjectPlay(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable soundObjectPlay(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto sound = getObjectAsSound(args, 0, ctx);
 
     // TODO: implement
@@ -1863,7 +1867,7 @@ Variable soundObjectPlay(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofNull();
 }
 
-Variable soundObjectStop(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable soundObjectStop(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto sound = getObjectAsSound(args, 0, ctx);
 
     // TODO: implement
@@ -1871,7 +1875,7 @@ Variable soundObjectStop(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofNull();
 }
 
-Variable soundObjectSetVolume(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable soundObjectSetVolume(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto sound = getObjectAsSound(args, 0, ctx);
     int volume = getInt(args, 1);
 
@@ -1880,7 +1884,7 @@ Variable soundObjectSetVolume(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable soundObjectSetPosition(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable soundObjectSetPosition(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto sound = getObjectAsSound(args, 0, ctx);
     auto position = getVector(args, 1);
 
@@ -1889,7 +1893,7 @@ Variable soundObjectSetPosition(const vector<Variable> &args, const RoutineConte
     return Variable::ofNull();
 }
 
-Variable getGold(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getGold(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target = getObjectOrCallerAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -1897,7 +1901,7 @@ Variable getGold(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(0);
 }
 
-Variable setLightsaberPowered(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setLightsaberPowered(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
     bool ovrrd = getIntAsBool(args, 1);
     bool powered = getIntAsBoolOrElse(args, 2, true);
@@ -1908,13 +1912,13 @@ Variable setLightsaberPowered(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable getLastSpellHarmful(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLastSpellHarmful(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofInt(R_FALSE);
 }
 
-Variable musicBackgroundPlay(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable musicBackgroundPlay(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto area = getObjectAsArea(args, 0, ctx);
 
     // TODO: implement
@@ -1922,7 +1926,7 @@ Variable musicBackgroundPlay(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable musicBackgroundStop(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable musicBackgroundStop(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto area = getObjectAsArea(args, 0, ctx);
 
     // TODO: implement
@@ -1930,7 +1934,7 @@ Variable musicBackgroundStop(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable musicBackgroundChangeDay(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable musicBackgroundChangeDay(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto area = getObjectAsArea(args, 0, ctx);
     int track = getInt(args, 1);
     bool streamingMusic = getIntAsBoolOrElse(args, 2, false);
@@ -1940,7 +1944,7 @@ Variable musicBackgroundChangeDay(const vector<Variable> &args, const RoutineCon
     return Variable::ofNull();
 }
 
-Variable musicBackgroundChangeNight(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable musicBackgroundChangeNight(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto area = getObjectAsArea(args, 0, ctx);
     int track = getInt(args, 1);
     bool streamingMusic = getIntAsBoolOrElse(args, 2, false);
@@ -1950,7 +1954,7 @@ Variable musicBackgroundChangeNight(const vector<Variable> &args, const RoutineC
     return Variable::ofNull();
 }
 
-Variable musicBattlePlay(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable musicBattlePlay(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto area = getObjectAsArea(args, 0, ctx);
 
     // TODO: implement
@@ -1958,7 +1962,7 @@ Variable musicBattlePlay(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofNull();
 }
 
-Variable musicBattleStop(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable musicBattleStop(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto area = getObjectAsArea(args, 0, ctx);
 
     // TODO: implement
@@ -1966,7 +1970,7 @@ Variable musicBattleStop(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofNull();
 }
 
-Variable ambientSoundPlay(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable ambientSoundPlay(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto area = getObjectAsArea(args, 0, ctx);
 
     // TODO: implement
@@ -1974,7 +1978,7 @@ Variable ambientSoundPlay(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofNull();
 }
 
-Variable ambientSoundStop(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable ambientSoundStop(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto area = getObjectAsArea(args, 0, ctx);
 
     // TODO: implement
@@ -1982,25 +1986,25 @@ Variable ambientSoundStop(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofNull();
 }
 
-Variable getLastKiller(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLastKiller(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getItemActivated(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getItemActivated(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getItemActivator(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getItemActivator(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getIsOpen(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIsOpen(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
 
     // TODO: implement
@@ -2008,7 +2012,7 @@ Variable getIsOpen(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(R_FALSE);
 }
 
-Variable takeGoldFromCreature(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable takeGoldFromCreature(const ArgumentSpan &args, const RoutineContext &ctx) {
     int amount = getInt(args, 0);
     auto creatureToTakeFrom = getObjectAsCreature(args, 1, ctx);
     bool destroy = getIntAsBoolOrElse(args, 2, false);
@@ -2018,7 +2022,7 @@ Variable takeGoldFromCreature(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable getIsInConversation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIsInConversation(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
 
     // TODO: implement
@@ -2026,7 +2030,7 @@ Variable getIsInConversation(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable getPlotFlag(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getPlotFlag(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target = getObjectOrCaller(args, 0, ctx);
 
     // TODO: implement
@@ -2034,7 +2038,7 @@ Variable getPlotFlag(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(0);
 }
 
-Variable setPlotFlag(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setPlotFlag(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target = getObject(args, 0, ctx);
     bool plotFlag = getIntAsBool(args, 1);
 
@@ -2043,7 +2047,7 @@ Variable setPlotFlag(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable setDialogPlaceableCamera(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setDialogPlaceableCamera(const ArgumentSpan &args, const RoutineContext &ctx) {
     int cameraId = getInt(args, 0);
 
     // TODO: implement
@@ -2051,13 +2055,13 @@ Variable setDialogPlaceableCamera(const vector<Variable> &args, const RoutineCon
     return Variable::ofNull();
 }
 
-Variable getSoloMode(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getSoloMode(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofInt(R_FALSE);
 }
 
-Variable setMaxStealthXP(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setMaxStealthXP(const ArgumentSpan &args, const RoutineContext &ctx) {
     int max = getInt(args, 0);
 
     // TODO: implement
@@ -2065,13 +2069,13 @@ Variable setMaxStealthXP(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofNull();
 }
 
-Variable getCurrentStealthXP(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getCurrentStealthXP(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofInt(0);
 }
 
-Variable getNumStackedItems(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getNumStackedItems(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto item = getObjectAsItem(args, 0, ctx);
 
     // TODO: implement
@@ -2079,13 +2083,13 @@ Variable getNumStackedItems(const vector<Variable> &args, const RoutineContext &
     return Variable::ofInt(0);
 }
 
-Variable surrenderToEnemies(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable surrenderToEnemies(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofNull();
 }
 
-Variable setCurrentStealthXP(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setCurrentStealthXP(const ArgumentSpan &args, const RoutineContext &ctx) {
     int current = getInt(args, 0);
 
     // TODO: implement
@@ -2093,7 +2097,7 @@ Variable setCurrentStealthXP(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable getCreatureSize(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getCreatureSize(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -2101,7 +2105,7 @@ Variable getCreatureSize(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofInt(static_cast<int>(CreatureSize::Invalid));
 }
 
-Variable awardStealthXP(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable awardStealthXP(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target = getObject(args, 0, ctx);
 
     // TODO: implement
@@ -2109,7 +2113,7 @@ Variable awardStealthXP(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable setStealthXPEnabled(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setStealthXPEnabled(const ArgumentSpan &args, const RoutineContext &ctx) {
     bool enabled = getIntAsBool(args, 0);
 
     // TODO: implement
@@ -2117,13 +2121,13 @@ Variable setStealthXPEnabled(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable getAttemptedMovementTarget(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getAttemptedMovementTarget(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getBlockingCreature(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getBlockingCreature(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target = getObjectOrCaller(args, 0, ctx);
 
     // TODO: implement
@@ -2131,7 +2135,7 @@ Variable getBlockingCreature(const vector<Variable> &args, const RoutineContext
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getChallengeRating(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getChallengeRating(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -2139,7 +2143,7 @@ Variable getChallengeRating(const vector<Variable> &args, const RoutineContext &
     return Variable::ofFloat(0.0f);
 }
 
-Variable getFoundEnemyCreature(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getFoundEnemyCreature(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target = getObjectOrCaller(args, 0, ctx);
 
     // TODO: implement
@@ -2147,7 +2151,7 @@ Variable getFoundEnemyCreature(const vector<Variable> &args, const RoutineContex
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getSubRace(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getSubRace(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -2155,7 +2159,7 @@ Variable getSubRace(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(0);
 }
 
-Variable duplicateHeadAppearance(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable duplicateHeadAppearance(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creatureToChange = getObjectAsCreature(args, 0, ctx);
     auto creatureToMatch = getObjectAsCreature(args, 1, ctx);
 
@@ -2164,7 +2168,7 @@ Variable duplicateHeadAppearance(const vector<Variable> &args, const RoutineCont
     return Variable::ofNull();
 }
 
-Variable cutsceneAttack(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable cutsceneAttack(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target = getObject(args, 0, ctx);
     int animation = getInt(args, 1);
     auto attackResult = getIntAsEnum<AttackResultType>(args, 2);
@@ -2175,7 +2179,7 @@ Variable cutsceneAttack(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable setLockOrientationInDialog(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setLockOrientationInDialog(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
     bool value = getIntAsBool(args, 1);
 
@@ -2184,7 +2188,7 @@ Variable setLockOrientationInDialog(const vector<Variable> &args, const RoutineC
     return Variable::ofNull();
 }
 
-Variable setLockHeadFollowInDialog(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setLockHeadFollowInDialog(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
     bool value = getIntAsBool(args, 1);
 
@@ -2193,7 +2197,7 @@ Variable setLockHeadFollowInDialog(const vector<Variable> &args, const RoutineCo
     return Variable::ofNull();
 }
 
-Variable enableVideoEffect(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable enableVideoEffect(const ArgumentSpan &args, const RoutineContext &ctx) {
     int effectType = getInt(args, 0);
 
     // TODO: implement
@@ -2201,7 +2205,7 @@ Variable enableVideoEffect(const vector<Variable> &args, const RoutineContext &c
     return Variable::ofNull();
 }
 
-Variable startNewModule(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable startNewModule(const ArgumentSpan &args, const RoutineContext &ctx) {
     string moduleName = boost::to_lower_copy(getString(args, 0));
     string waypoint = boost::to_lower_copy(getStringOrElse(args, 1, ""));
     string movie1 = boost::to_lower_copy(getStringOrElse(args, 2, ""));
@@ -2216,25 +2220,25 @@ Variable startNewModule(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable disableVideoEffect(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable disableVideoEffect(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofNull();
 }
 
-Variable doSinglePlayerAutoSave(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable doSinglePlayerAutoSave(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofNull();
 }
 
-Variable getGameDifficulty(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getGameDifficulty(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofInt(static_cast<int>(GameDifficulty::Normal));
 }
 
-Variable getUserActionsPending(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getUserActionsPending(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto caller = getCallerAsCreature(ctx);
 
     // TODO: implement
@@ -2242,7 +2246,7 @@ Variable getUserActionsPending(const vector<Variable> &args, const RoutineContex
     return Variable::ofInt(R_FALSE);
 }
 
-Variable revealMap(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable revealMap(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto point = getVectorOrElse(args, 0, glm::vec3(0.0f));
     int radius = getIntOrElse(args, 1, -1);
 
@@ -2251,7 +2255,7 @@ Variable revealMap(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable showTutorialWindow(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable showTutorialWindow(const ArgumentSpan &args, const RoutineContext &ctx) {
     int window = getInt(args, 0);
 
     // TODO: implement
@@ -2259,7 +2263,7 @@ Variable showTutorialWindow(const vector<Variable> &args, const RoutineContext &
     return Variable::ofNull();
 }
 
-Variable startCreditSequence(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable startCreditSequence(const ArgumentSpan &args, const RoutineContext &ctx) {
     bool transparentBackground = getIntAsBool(args, 0);
 
     // TODO: implement
@@ -2267,13 +2271,13 @@ Variable startCreditSequence(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable isCreditSequenceInProgress(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable isCreditSequenceInProgress(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getCurrentAction(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getCurrentAction(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObjectOrCaller(args, 0, ctx);
 
     // TODO: implement
@@ -2281,7 +2285,7 @@ Variable getCurrentAction(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofInt(0);
 }
 
-Variable getAppearanceType(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getAppearanceType(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -2289,7 +2293,7 @@ Variable getAppearanceType(const vector<Variable> &args, const RoutineContext &c
     return Variable::ofInt(0);
 }
 
-Variable getTrapBaseType(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getTrapBaseType(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto trapObject = getObject(args, 0, ctx);
 
     // TODO: implement
@@ -2297,26 +2301,26 @@ Variable getTrapBaseType(const vector<Variable> &args, const RoutineContext &ctx
     throw NotImplementedException();
 }
 
-Variable getFirstPC(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getFirstPC(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getNextPC(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getNextPC(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable setTrapDetectedBy(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setTrapDetectedBy(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto trap = getObject(args, 0, ctx);
     auto detector = getObject(args, 1, ctx);
 
     throw NotImplementedException();
 }
 
-Variable getIsTrapped(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIsTrapped(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
 
     // TODO: implement
@@ -2324,7 +2328,7 @@ Variable getIsTrapped(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(R_FALSE);
 }
 
-Variable setEffectIcon(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setEffectIcon(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto effect = getEffect(args, 0);
     int icon = getInt(args, 1);
 
@@ -2333,7 +2337,7 @@ Variable setEffectIcon(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofEffect(nullptr);
 }
 
-Variable faceObjectAwayFromObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable faceObjectAwayFromObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto facer = getObject(args, 0, ctx);
     auto objectToFaceAwayFrom = getObject(args, 1, ctx);
 
@@ -2342,7 +2346,7 @@ Variable faceObjectAwayFromObject(const vector<Variable> &args, const RoutineCon
     return Variable::ofNull();
 }
 
-Variable getLastHostileActor(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLastHostileActor(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto attacker = getObjectOrCaller(args, 0, ctx);
 
     // TODO: implement
@@ -2350,13 +2354,13 @@ Variable getLastHostileActor(const vector<Variable> &args, const RoutineContext
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getModuleName(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getModuleName(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofString("");
 }
 
-Variable endGame(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable endGame(const ArgumentSpan &args, const RoutineContext &ctx) {
     bool showEndGameGUI = getIntAsBoolOrElse(args, 0, true);
 
     // TODO: implement
@@ -2364,11 +2368,11 @@ Variable endGame(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable getRunScriptVar(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getRunScriptVar(const ArgumentSpan &args, const RoutineContext &ctx) {
     return Variable::ofInt(ctx.execution.scriptVar);
 }
 
-Variable getCreatureMovmentType(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getCreatureMovmentType(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -2376,7 +2380,7 @@ Variable getCreatureMovmentType(const vector<Variable> &args, const RoutineConte
     return Variable::ofInt(static_cast<int>(MovementSpeed::Immobile));
 }
 
-Variable musicBackgroundGetBattleTrack(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable musicBackgroundGetBattleTrack(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto area = getObjectAsArea(args, 0, ctx);
 
     // TODO: implement
@@ -2384,7 +2388,7 @@ Variable musicBackgroundGetBattleTrack(const vector<Variable> &args, const Routi
     return Variable::ofNull();
 }
 
-Variable getHasInventory(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getHasInventory(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
 
     // TODO: implement
@@ -2392,7 +2396,7 @@ Variable getHasInventory(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofInt(R_FALSE);
 }
 
-Variable addToParty(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable addToParty(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto pc = getObjectAsCreature(args, 0, ctx);
     auto partyLeader = getObjectAsCreature(args, 1, ctx);
 
@@ -2401,7 +2405,7 @@ Variable addToParty(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable removeFromParty(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable removeFromParty(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto pc = getObjectAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -2409,7 +2413,7 @@ Variable removeFromParty(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofNull();
 }
 
-Variable addPartyMember(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable addPartyMember(const ArgumentSpan &args, const RoutineContext &ctx) {
     int npc = getInt(args, 0);
     auto creature = getObjectAsCreature(args, 1, ctx);
 
@@ -2418,7 +2422,7 @@ Variable addPartyMember(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofInt(R_FALSE);
 }
 
-Variable removePartyMember(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable removePartyMember(const ArgumentSpan &args, const RoutineContext &ctx) {
     int npc = getInt(args, 0);
 
     // TODO: implement
@@ -2426,7 +2430,7 @@ Variable removePartyMember(const vector<Variable> &args, const RoutineContext &c
     return Variable::ofInt(R_FALSE);
 }
 
-Variable isObjectPartyMember(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable isObjectPartyMember(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -2434,7 +2438,7 @@ Variable isObjectPartyMember(const vector<Variable> &args, const RoutineContext
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getPartyMemberByIndex(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getPartyMemberByIndex(const ArgumentSpan &args, const RoutineContext &ctx) {
     int index = getInt(args, 0);
 
     // TODO: implement
@@ -2442,7 +2446,7 @@ Variable getPartyMemberByIndex(const vector<Variable> &args, const RoutineContex
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getGlobalBoolean(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getGlobalBoolean(const ArgumentSpan &args, const RoutineContext &ctx) {
     string identifier = getString(args, 0);
 
     // TODO: implement
@@ -2450,7 +2454,7 @@ Variable getGlobalBoolean(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofInt(R_FALSE);
 }
 
-Variable setGlobalBoolean(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setGlobalBoolean(const ArgumentSpan &args, const RoutineContext &ctx) {
     string identifier = getString(args, 0);
     bool value = getIntAsBool(args, 1);
 
@@ -2459,7 +2463,7 @@ Variable setGlobalBoolean(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofNull();
 }
 
-Variable getGlobalNumber(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getGlobalNumber(const ArgumentSpan &args, const RoutineContext &ctx) {
     string identifier = getString(args, 0);
 
     // TODO: implement
@@ -2467,7 +2471,7 @@ Variable getGlobalNumber(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofInt(0);
 }
 
-Variable setGlobalNumber(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setGlobalNumber(const ArgumentSpan &args, const RoutineContext &ctx) {
     string identifier = getString(args, 0);
     int value = getInt(args, 1);
 
@@ -2476,7 +2480,7 @@ Variable setGlobalNumber(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofNull();
 }
 
-Variable aurPostString(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable aurPostString(const ArgumentSpan &args, const RoutineContext &ctx) {
     string str = getString(args, 0);
     int x = getInt(args, 1);
     int y = getInt(args, 2);
@@ -2487,7 +2491,7 @@ Variable aurPostString(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable barkString(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable barkString(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
     int strRef = getInt(args, 1);
     int barkX = getIntOrElse(args, 2, -1);
@@ -2498,7 +2502,7 @@ Variable barkString(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable playVisualAreaEffect(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable playVisualAreaEffect(const ArgumentSpan &args, const RoutineContext &ctx) {
     int effectId = getInt(args, 0);
     auto target = getLocationArgument(args, 1);
 
@@ -2507,7 +2511,7 @@ Variable playVisualAreaEffect(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable getLocalBoolean(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLocalBoolean(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
     int index = getInt(args, 1);
 
@@ -2516,7 +2520,7 @@ Variable getLocalBoolean(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofInt(R_FALSE);
 }
 
-Variable setLocalBoolean(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setLocalBoolean(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
     int index = getInt(args, 1);
     bool value = getIntAsBool(args, 2);
@@ -2526,7 +2530,7 @@ Variable setLocalBoolean(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofNull();
 }
 
-Variable getLocalNumber(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLocalNumber(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
     int index = getInt(args, 1);
 
@@ -2535,7 +2539,7 @@ Variable getLocalNumber(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofInt(0);
 }
 
-Variable setLocalNumber(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setLocalNumber(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
     int index = getInt(args, 1);
     int value = getInt(args, 2);
@@ -2545,13 +2549,13 @@ Variable setLocalNumber(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable soundObjectGetPitchVariance(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable soundObjectGetPitchVariance(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto sound = getObjectAsSound(args, 0, ctx);
 
     throw NotImplementedException();
 }
 
-Variable getGlobalLocation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getGlobalLocation(const ArgumentSpan &args, const RoutineContext &ctx) {
     string identifier = getString(args, 0);
 
     // TODO: implement
@@ -2559,7 +2563,7 @@ Variable getGlobalLocation(const vector<Variable> &args, const RoutineContext &c
     return Variable::ofLocation(nullptr);
 }
 
-Variable setGlobalLocation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setGlobalLocation(const ArgumentSpan &args, const RoutineContext &ctx) {
     string identifier = getString(args, 0);
     auto value = getLocationArgument(args, 1);
 
@@ -2568,7 +2572,7 @@ Variable setGlobalLocation(const vector<Variable> &args, const RoutineContext &c
     return Variable::ofNull();
 }
 
-Variable addAvailableNPCByObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable addAvailableNPCByObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     int npc = getInt(args, 0);
     auto creature = getObjectAsCreature(args, 1, ctx);
 
@@ -2577,7 +2581,7 @@ Variable addAvailableNPCByObject(const vector<Variable> &args, const RoutineCont
     return Variable::ofInt(R_FALSE);
 }
 
-Variable removeAvailableNPC(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable removeAvailableNPC(const ArgumentSpan &args, const RoutineContext &ctx) {
     int npc = getInt(args, 0);
 
     // TODO: implement
@@ -2585,7 +2589,7 @@ Variable removeAvailableNPC(const vector<Variable> &args, const RoutineContext &
     return Variable::ofInt(R_FALSE);
 }
 
-Variable isAvailableCreature(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable isAvailableCreature(const ArgumentSpan &args, const RoutineContext &ctx) {
     int npc = getInt(args, 0);
 
     // TODO: implement
@@ -2593,7 +2597,7 @@ Variable isAvailableCreature(const vector<Variable> &args, const RoutineContext
     return Variable::ofInt(R_FALSE);
 }
 
-Variable addAvailableNPCByTemplate(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable addAvailableNPCByTemplate(const ArgumentSpan &args, const RoutineContext &ctx) {
     int npc = getInt(args, 0);
     string tmplt = boost::to_lower_copy(getString(args, 1));
 
@@ -2602,7 +2606,7 @@ Variable addAvailableNPCByTemplate(const vector<Variable> &args, const RoutineCo
     return Variable::ofInt(R_FALSE);
 }
 
-Variable spawnAvailableNPC(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable spawnAvailableNPC(const ArgumentSpan &args, const RoutineContext &ctx) {
     int npc = getInt(args, 0);
     auto position = getLocationArgument(args, 1);
 
@@ -2611,7 +2615,7 @@ Variable spawnAvailableNPC(const vector<Variable> &args, const RoutineContext &c
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable isNPCPartyMember(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable isNPCPartyMember(const ArgumentSpan &args, const RoutineContext &ctx) {
     int npc = getInt(args, 0);
 
     // TODO: implement
@@ -2619,19 +2623,19 @@ Variable isNPCPartyMember(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getIsConversationActive(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIsConversationActive(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getPartyAIStyle(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getPartyAIStyle(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofInt(static_cast<int>(PartyAIStyle::Aggressive));
 }
 
-Variable getNPCAIStyle(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getNPCAIStyle(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -2639,7 +2643,7 @@ Variable getNPCAIStyle(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofInt(0);
 }
 
-Variable setNPCAIStyle(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setNPCAIStyle(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
     auto style = getIntAsEnum<NPCAIStyle>(args, 1);
 
@@ -2648,7 +2652,7 @@ Variable setNPCAIStyle(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable setNPCSelectability(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setNPCSelectability(const ArgumentSpan &args, const RoutineContext &ctx) {
     int npc = getInt(args, 0);
     int selectability = getInt(args, 1);
 
@@ -2657,7 +2661,7 @@ Variable setNPCSelectability(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable getNPCSelectability(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getNPCSelectability(const ArgumentSpan &args, const RoutineContext &ctx) {
     int npc = getInt(args, 0);
 
     // TODO: implement
@@ -2665,7 +2669,7 @@ Variable getNPCSelectability(const vector<Variable> &args, const RoutineContext
     return Variable::ofInt(-1);
 }
 
-Variable clearAllEffects(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable clearAllEffects(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto caller = getCaller(ctx);
 
     // TODO: implement
@@ -2673,7 +2677,7 @@ Variable clearAllEffects(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofNull();
 }
 
-Variable showPartySelectionGUI(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable showPartySelectionGUI(const ArgumentSpan &args, const RoutineContext &ctx) {
     string exitScript = boost::to_lower_copy(getStringOrElse(args, 0, ""));
     int forceNpc1 = getIntOrElse(args, 1, -1);
     int forceNpc2 = getIntOrElse(args, 2, -1);
@@ -2684,7 +2688,7 @@ Variable showPartySelectionGUI(const vector<Variable> &args, const RoutineContex
     return Variable::ofNull();
 }
 
-Variable getStandardFaction(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getStandardFaction(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObjectAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -2692,7 +2696,7 @@ Variable getStandardFaction(const vector<Variable> &args, const RoutineContext &
     return Variable::ofInt(0);
 }
 
-Variable givePlotXP(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable givePlotXP(const ArgumentSpan &args, const RoutineContext &ctx) {
     string plotName = getString(args, 0);
     int percentage = getInt(args, 1);
 
@@ -2701,7 +2705,7 @@ Variable givePlotXP(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable getMinOneHP(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getMinOneHP(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
 
     // TODO: implement
@@ -2709,7 +2713,7 @@ Variable getMinOneHP(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(R_FALSE);
 }
 
-Variable setMinOneHP(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setMinOneHP(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
     bool minOneHP = getIntAsBool(args, 1);
 
@@ -2718,7 +2722,7 @@ Variable setMinOneHP(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable setGlobalFadeIn(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setGlobalFadeIn(const ArgumentSpan &args, const RoutineContext &ctx) {
     float wait = getFloatOrElse(args, 0, 0.0f);
     float length = getFloatOrElse(args, 1, 0.0f);
     float r = getFloatOrElse(args, 2, 0.0f);
@@ -2730,7 +2734,7 @@ Variable setGlobalFadeIn(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofNull();
 }
 
-Variable setGlobalFadeOut(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setGlobalFadeOut(const ArgumentSpan &args, const RoutineContext &ctx) {
     float wait = getFloatOrElse(args, 0, 0.0f);
     float length = getFloatOrElse(args, 1, 0.0f);
     float r = getFloatOrElse(args, 2, 0.0f);
@@ -2742,7 +2746,7 @@ Variable setGlobalFadeOut(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofNull();
 }
 
-Variable getLastHostileTarget(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLastHostileTarget(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto attacker = getObjectOrCaller(args, 0, ctx);
 
     // TODO: implement
@@ -2750,7 +2754,7 @@ Variable getLastHostileTarget(const vector<Variable> &args, const RoutineContext
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getLastAttackAction(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLastAttackAction(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto attacker = getObjectOrCaller(args, 0, ctx);
 
     // TODO: implement
@@ -2758,13 +2762,13 @@ Variable getLastAttackAction(const vector<Variable> &args, const RoutineContext
     return Variable::ofInt(static_cast<int>(ActionType::Invalid));
 }
 
-Variable getLastForcePowerUsed(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLastForcePowerUsed(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto attacker = getObjectOrCaller(args, 0, ctx);
 
     throw NotImplementedException();
 }
 
-Variable getLastCombatFeatUsed(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLastCombatFeatUsed(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto attacker = getObjectOrCaller(args, 0, ctx);
 
     // TODO: implement
@@ -2772,7 +2776,7 @@ Variable getLastCombatFeatUsed(const vector<Variable> &args, const RoutineContex
     return Variable::ofInt(static_cast<int>(FeatType::Invalid));
 }
 
-Variable getLastAttackResult(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLastAttackResult(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto attacker = getObjectOrCaller(args, 0, ctx);
 
     // TODO: implement
@@ -2780,7 +2784,7 @@ Variable getLastAttackResult(const vector<Variable> &args, const RoutineContext
     return Variable::ofInt(static_cast<int>(AttackResultType::Invalid));
 }
 
-Variable getWasForcePowerSuccessful(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getWasForcePowerSuccessful(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto attacker = getObjectOrCaller(args, 0, ctx);
 
     // TODO: implement
@@ -2788,7 +2792,7 @@ Variable getWasForcePowerSuccessful(const vector<Variable> &args, const RoutineC
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getIsDebilitated(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIsDebilitated(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectOrCallerAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -2796,7 +2800,7 @@ Variable getIsDebilitated(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofInt(R_FALSE);
 }
 
-Variable playMovie(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable playMovie(const ArgumentSpan &args, const RoutineContext &ctx) {
     string movie = boost::to_lower_copy(getString(args, 0));
     bool streamingMusic = getIntAsBoolOrElse(args, 1, false);
 
@@ -2805,7 +2809,7 @@ Variable playMovie(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable saveNPCState(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable saveNPCState(const ArgumentSpan &args, const RoutineContext &ctx) {
     int npc = getInt(args, 0);
 
     // TODO: implement
@@ -2813,13 +2817,13 @@ Variable saveNPCState(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable getCategoryFromTalent(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getCategoryFromTalent(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto talent = getTalent(args, 0);
 
     throw NotImplementedException();
 }
 
-Variable surrenderByFaction(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable surrenderByFaction(const ArgumentSpan &args, const RoutineContext &ctx) {
     int factionFrom = getInt(args, 0);
     int factionTo = getInt(args, 1);
 
@@ -2828,7 +2832,7 @@ Variable surrenderByFaction(const vector<Variable> &args, const RoutineContext &
     return Variable::ofNull();
 }
 
-Variable changeFactionByFaction(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable changeFactionByFaction(const ArgumentSpan &args, const RoutineContext &ctx) {
     int factionFrom = getInt(args, 0);
     int factionTo = getInt(args, 1);
 
@@ -2837,7 +2841,7 @@ Variable changeFactionByFaction(const vector<Variable> &args, const RoutineConte
     return Variable::ofNull();
 }
 
-Variable playRoomAnimation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable playRoomAnimation(const ArgumentSpan &args, const RoutineContext &ctx) {
     string room = getString(args, 0);
     int animation = getInt(args, 1);
 
@@ -2846,7 +2850,7 @@ Variable playRoomAnimation(const vector<Variable> &args, const RoutineContext &c
     return Variable::ofNull();
 }
 
-Variable showGalaxyMap(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable showGalaxyMap(const ArgumentSpan &args, const RoutineContext &ctx) {
     int planet = getInt(args, 0);
 
     // TODO: implement
@@ -2854,7 +2858,7 @@ Variable showGalaxyMap(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable setPlanetSelectable(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setPlanetSelectable(const ArgumentSpan &args, const RoutineContext &ctx) {
     int planet = getInt(args, 0);
     bool selectable = getIntAsBool(args, 1);
 
@@ -2863,7 +2867,7 @@ Variable setPlanetSelectable(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable setPlanetAvailable(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setPlanetAvailable(const ArgumentSpan &args, const RoutineContext &ctx) {
     int planet = getInt(args, 0);
     bool available = getIntAsBool(args, 1);
 
@@ -2872,20 +2876,20 @@ Variable setPlanetAvailable(const vector<Variable> &args, const RoutineContext &
     return Variable::ofNull();
 }
 
-Variable getSelectedPlanet(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getSelectedPlanet(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofInt(-1);
 }
 
-Variable soundObjectFadeAndStop(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable soundObjectFadeAndStop(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto sound = getObjectAsSound(args, 0, ctx);
     float seconds = getFloat(args, 1);
 
     throw NotImplementedException();
 }
 
-Variable changeItemCost(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable changeItemCost(const ArgumentSpan &args, const RoutineContext &ctx) {
     string item = getString(args, 0);
     float costMultiplier = getFloat(args, 1);
 
@@ -2894,19 +2898,19 @@ Variable changeItemCost(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable getIsLiveContentAvailable(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIsLiveContentAvailable(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofInt(R_TRUE);
 }
 
-Variable resetDialogState(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable resetDialogState(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofNull();
 }
 
-Variable getIsPoisoned(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIsPoisoned(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
 
     // TODO: implement
@@ -2914,7 +2918,7 @@ Variable getIsPoisoned(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getSpellTarget(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getSpellTarget(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectOrCallerAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -2922,7 +2926,7 @@ Variable getSpellTarget(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable setSoloMode(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setSoloMode(const ArgumentSpan &args, const RoutineContext &ctx) {
     bool activate = getIntAsBool(args, 0);
 
     // TODO: implement
@@ -2930,13 +2934,13 @@ Variable setSoloMode(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable cancelPostDialogCharacterSwitch(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable cancelPostDialogCharacterSwitch(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofNull();
 }
 
-Variable setMaxHitPoints(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setMaxHitPoints(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
     int maxHP = getInt(args, 1);
 
@@ -2945,7 +2949,7 @@ Variable setMaxHitPoints(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofNull();
 }
 
-Variable noClicksFor(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable noClicksFor(const ArgumentSpan &args, const RoutineContext &ctx) {
     float duration = getFloat(args, 0);
 
     // TODO: implement
@@ -2953,28 +2957,28 @@ Variable noClicksFor(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable holdWorldFadeInForDialog(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable holdWorldFadeInForDialog(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofNull();
 }
 
-Variable shipBuild(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable shipBuild(const ArgumentSpan &args, const RoutineContext &ctx) {
     return Variable::ofInt(static_cast<int>(kShipBuild));
 }
 
-Variable surrenderRetainBuffs(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable surrenderRetainBuffs(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofNull();
 }
 
-Variable getCheatCode(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getCheatCode(const ArgumentSpan &args, const RoutineContext &ctx) {
     int code = getInt(args, 0);
     return Variable::ofInt(R_FALSE); // cheat codes are not supported
 }
 
-Variable setMusicVolume(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setMusicVolume(const ArgumentSpan &args, const RoutineContext &ctx) {
     float volume = getFloatOrElse(args, 0, 1.0f);
 
     // TODO: implement
@@ -2982,7 +2986,7 @@ Variable setMusicVolume(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable createItemOnFloor(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable createItemOnFloor(const ArgumentSpan &args, const RoutineContext &ctx) {
     string tmplt = getString(args, 0);
     auto location = getLocationArgument(args, 1);
     bool useAppearAnimation = getIntAsBoolOrElse(args, 2, false);
@@ -2992,7 +2996,7 @@ Variable createItemOnFloor(const vector<Variable> &args, const RoutineContext &c
     return Variable::ofNull();
 }
 
-Variable setAvailableNPCId(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setAvailableNPCId(const ArgumentSpan &args, const RoutineContext &ctx) {
     int npc = getInt(args, 0);
     auto npcObject = getObject(args, 1, ctx);
 
@@ -3001,7 +3005,7 @@ Variable setAvailableNPCId(const vector<Variable> &args, const RoutineContext &c
     return Variable::ofNull();
 }
 
-Variable queueMovie(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable queueMovie(const ArgumentSpan &args, const RoutineContext &ctx) {
     string movie = getString(args, 0);
     bool skippable = getIntAsBoolOrElse(args, 1, true);
 
@@ -3010,7 +3014,7 @@ Variable queueMovie(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable playMovieQueue(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable playMovieQueue(const ArgumentSpan &args, const RoutineContext &ctx) {
     bool allowSkips = getIntAsBoolOrElse(args, 0, true);
 
     // TODO: implement
@@ -3018,7 +3022,7 @@ Variable playMovieQueue(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable yavinHackCloseDoor(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable yavinHackCloseDoor(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto door = getObjectAsDoor(args, 0, ctx);
 
     // TODO: implement
@@ -3028,7 +3032,7 @@ Variable yavinHackCloseDoor(const vector<Variable> &args, const RoutineContext &
 
 // TSL
 
-Variable getScriptParameter(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getScriptParameter(const ArgumentSpan &args, const RoutineContext &ctx) {
     int index = getInt(args, 0);
 
     // TODO: implement
@@ -3036,13 +3040,13 @@ Variable getScriptParameter(const vector<Variable> &args, const RoutineContext &
     return Variable::ofInt(0);
 }
 
-Variable setFadeUntilScript(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setFadeUntilScript(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofNull();
 }
 
-Variable showChemicalUpgradeScreen(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable showChemicalUpgradeScreen(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto character = getObject(args, 0, ctx);
 
     // TODO: implement
@@ -3050,13 +3054,13 @@ Variable showChemicalUpgradeScreen(const vector<Variable> &args, const RoutineCo
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getSpellForcePointCost(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getSpellForcePointCost(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofInt(0);
 }
 
-Variable getFeatAcquired(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getFeatAcquired(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto feat = getIntAsEnum<FeatType>(args, 0);
     auto creature = getObjectOrCallerAsCreature(args, 1, ctx);
 
@@ -3065,7 +3069,7 @@ Variable getFeatAcquired(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getSpellAcquired(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getSpellAcquired(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto spell = getIntAsEnum<SpellType>(args, 0);
     auto creature = getObjectOrCallerAsCreature(args, 1, ctx);
 
@@ -3074,13 +3078,13 @@ Variable getSpellAcquired(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofInt(R_FALSE);
 }
 
-Variable showSwoopUpgradeScreen(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable showSwoopUpgradeScreen(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofNull();
 }
 
-Variable grantFeat(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable grantFeat(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto feat = getIntAsEnum<FeatType>(args, 0);
     auto creature = getObjectAsCreature(args, 1, ctx);
 
@@ -3089,7 +3093,7 @@ Variable grantFeat(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable grantSpell(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable grantSpell(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto spell = getIntAsEnum<SpellType>(args, 0);
     auto creature = getObjectAsCreature(args, 1, ctx);
 
@@ -3098,7 +3102,7 @@ Variable grantSpell(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable spawnMine(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable spawnMine(const ArgumentSpan &args, const RoutineContext &ctx) {
     int mineType = getInt(args, 0);
     auto point = getLocationArgument(args, 1);
     int detectDCBase = getInt(args, 2);
@@ -3110,7 +3114,7 @@ Variable spawnMine(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable setFakeCombatState(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setFakeCombatState(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
     bool enable = getIntAsBool(args, 1);
 
@@ -3119,7 +3123,7 @@ Variable setFakeCombatState(const vector<Variable> &args, const RoutineContext &
     return Variable::ofNull();
 }
 
-Variable getOwnerDemolitionsSkill(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getOwnerDemolitionsSkill(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
 
     // TODO: implement
@@ -3127,7 +3131,7 @@ Variable getOwnerDemolitionsSkill(const vector<Variable> &args, const RoutineCon
     return Variable::ofInt(0);
 }
 
-Variable setOrientOnClick(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setOrientOnClick(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObjectOrCallerAsCreature(args, 0, ctx);
     bool state = getIntAsBool(args, 1);
 
@@ -3136,7 +3140,7 @@ Variable setOrientOnClick(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofNull();
 }
 
-Variable getInfluence(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getInfluence(const ArgumentSpan &args, const RoutineContext &ctx) {
     int npc = getInt(args, 0);
 
     // TODO: implement
@@ -3144,7 +3148,7 @@ Variable getInfluence(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(0);
 }
 
-Variable setInfluence(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setInfluence(const ArgumentSpan &args, const RoutineContext &ctx) {
     int npc = getInt(args, 0);
     int influence = getInt(args, 1);
 
@@ -3153,7 +3157,7 @@ Variable setInfluence(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable modifyInfluence(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable modifyInfluence(const ArgumentSpan &args, const RoutineContext &ctx) {
     int npc = getInt(args, 0);
     int modifier = getInt(args, 1);
 
@@ -3162,7 +3166,7 @@ Variable modifyInfluence(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofNull();
 }
 
-Variable incrementGlobalNumber(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable incrementGlobalNumber(const ArgumentSpan &args, const RoutineContext &ctx) {
     string identifier = getString(args, 0);
     int amount = getInt(args, 1);
 
@@ -3171,7 +3175,7 @@ Variable incrementGlobalNumber(const vector<Variable> &args, const RoutineContex
     return Variable::ofNull();
 }
 
-Variable decrementGlobalNumber(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable decrementGlobalNumber(const ArgumentSpan &args, const RoutineContext &ctx) {
     string identifier = getString(args, 0);
     int amount = getInt(args, 1);
 
@@ -3180,7 +3184,7 @@ Variable decrementGlobalNumber(const vector<Variable> &args, const RoutineContex
     return Variable::ofNull();
 }
 
-Variable addBonusForcePoints(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable addBonusForcePoints(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
     int bonusFP = getInt(args, 1);
 
@@ -3189,7 +3193,7 @@ Variable addBonusForcePoints(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable isStealthed(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable isStealthed(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -3197,7 +3201,7 @@ Variable isStealthed(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(R_FALSE);
 }
 
-Variable isMeditating(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable isMeditating(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -3205,7 +3209,7 @@ Variable isMeditating(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(R_FALSE);
 }
 
-Variable setHealTarget(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setHealTarget(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto healer = getObject(args, 0, ctx);
     auto target = getObject(args, 1, ctx);
 
@@ -3214,7 +3218,7 @@ Variable setHealTarget(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable getHealTarget(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getHealTarget(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto healer = getObject(args, 0, ctx);
 
     // TODO: implement
@@ -3222,14 +3226,14 @@ Variable getHealTarget(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getRandomDestination(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getRandomDestination(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
     int rangeLimit = getInt(args, 1);
 
     throw NotImplementedException();
 }
 
-Variable isFormActive(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable isFormActive(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
     int formID = getInt(args, 1);
 
@@ -3238,7 +3242,7 @@ Variable isFormActive(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getSpellBaseForcePointCost(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getSpellBaseForcePointCost(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto spellID = getInt(args, 0);
 
     // TODO: implement
@@ -3246,7 +3250,7 @@ Variable getSpellBaseForcePointCost(const vector<Variable> &args, const RoutineC
     return Variable::ofInt(0);
 }
 
-Variable setKeepStealthInDialog(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setKeepStealthInDialog(const ArgumentSpan &args, const RoutineContext &ctx) {
     bool stealthState = getIntAsBool(args, 0);
 
     // TODO: implement
@@ -3254,7 +3258,7 @@ Variable setKeepStealthInDialog(const vector<Variable> &args, const RoutineConte
     return Variable::ofNull();
 }
 
-Variable hasLineOfSight(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable hasLineOfSight(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto vSource = getVector(args, 0);
     auto vTarget = getVector(args, 1);
     auto oSource = getObjectOrNull(args, 2, ctx);
@@ -3265,15 +3269,15 @@ Variable hasLineOfSight(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofInt(R_FALSE);
 }
 
-Variable forceHeartbeat(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable forceHeartbeat(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
 
-    // TODO: implement
+    ctx.game.forceHeartbeat(creature->id());
 
     return Variable::ofNull();
 }
 
-Variable isRunning(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable isRunning(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
 
     // TODO: implement
@@ -3281,7 +3285,7 @@ Variable isRunning(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(0);
 }
 
-Variable setForfeitConditions(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setForfeitConditions(const ArgumentSpan &args, const RoutineContext &ctx) {
     int forfeitFlags = getInt(args, 0);
 
     // TODO: implement
@@ -3289,13 +3293,13 @@ Variable setForfeitConditions(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable getLastForfeitViolation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getLastForfeitViolation(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofInt(0);
 }
 
-Variable modifyReflexSavingThrowBase(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable modifyReflexSavingThrowBase(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
     int modValue = getInt(args, 1);
 
@@ -3304,7 +3308,7 @@ Variable modifyReflexSavingThrowBase(const vector<Variable> &args, const Routine
     return Variable::ofNull();
 }
 
-Variable modifyFortitudeSavingThrowBase(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable modifyFortitudeSavingThrowBase(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
     int modValue = getInt(args, 1);
 
@@ -3313,7 +3317,7 @@ Variable modifyFortitudeSavingThrowBase(const vector<Variable> &args, const Rout
     return Variable::ofNull();
 }
 
-Variable modifyWillSavingThrowBase(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable modifyWillSavingThrowBase(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
     int modValue = getInt(args, 1);
 
@@ -3322,11 +3326,11 @@ Variable modifyWillSavingThrowBase(const vector<Variable> &args, const RoutineCo
     return Variable::ofNull();
 }
 
-Variable getScriptStringParameter(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getScriptStringParameter(const ArgumentSpan &args, const RoutineContext &ctx) {
     throw NotImplementedException();
 }
 
-Variable getObjectPersonalSpace(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getObjectPersonalSpace(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
 
     // TODO: implement
@@ -3334,7 +3338,7 @@ Variable getObjectPersonalSpace(const vector<Variable> &args, const RoutineConte
     return Variable::ofFloat(0.0f);
 }
 
-Variable adjustCreatureAttributes(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable adjustCreatureAttributes(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
     auto attribute = getIntAsEnum<Ability>(args, 1);
     int amount = getInt(args, 2);
@@ -3344,7 +3348,7 @@ Variable adjustCreatureAttributes(const vector<Variable> &args, const RoutineCon
     return Variable::ofNull();
 }
 
-Variable setCreatureAILevel(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setCreatureAILevel(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
     int priority = getInt(args, 1);
 
@@ -3353,7 +3357,7 @@ Variable setCreatureAILevel(const vector<Variable> &args, const RoutineContext &
     return Variable::ofNull();
 }
 
-Variable resetCreatureAILevel(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable resetCreatureAILevel(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
 
     // TODO: implement
@@ -3361,7 +3365,7 @@ Variable resetCreatureAILevel(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable addAvailablePUPByObject(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable addAvailablePUPByObject(const ArgumentSpan &args, const RoutineContext &ctx) {
     int pup = getInt(args, 0);
     auto puppet = getObject(args, 1, ctx);
 
@@ -3370,7 +3374,7 @@ Variable addAvailablePUPByObject(const vector<Variable> &args, const RoutineCont
     return Variable::ofInt(R_FALSE);
 }
 
-Variable assignPUP(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable assignPUP(const ArgumentSpan &args, const RoutineContext &ctx) {
     int pup = getInt(args, 0);
     int npc = getInt(args, 1);
 
@@ -3379,7 +3383,7 @@ Variable assignPUP(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(R_FALSE);
 }
 
-Variable spawnAvailablePUP(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable spawnAvailablePUP(const ArgumentSpan &args, const RoutineContext &ctx) {
     int pup = getInt(args, 0);
     auto location = getLocationArgument(args, 1);
 
@@ -3388,7 +3392,7 @@ Variable spawnAvailablePUP(const vector<Variable> &args, const RoutineContext &c
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getPUPOwner(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getPUPOwner(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto pup = getObjectOrCaller(args, 0, ctx);
 
     // TODO: implement
@@ -3396,7 +3400,7 @@ Variable getPUPOwner(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable getIsPuppet(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIsPuppet(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto pup = getObjectOrCaller(args, 0, ctx);
 
     // TODO: implement
@@ -3404,7 +3408,7 @@ Variable getIsPuppet(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getIsPartyLeader(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIsPartyLeader(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto character = getObjectOrCaller(args, 0, ctx);
 
     // TODO: implement
@@ -3412,13 +3416,13 @@ Variable getIsPartyLeader(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getPartyLeader(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getPartyLeader(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofObject(kObjectInvalid);
 }
 
-Variable removeNPCFromPartyToBase(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable removeNPCFromPartyToBase(const ArgumentSpan &args, const RoutineContext &ctx) {
     int npc = getInt(args, 0);
 
     // TODO: implement
@@ -3426,7 +3430,7 @@ Variable removeNPCFromPartyToBase(const vector<Variable> &args, const RoutineCon
     return Variable::ofInt(R_FALSE);
 }
 
-Variable creatureFlourishWeapon(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable creatureFlourishWeapon(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
 
     // TODO: implement
@@ -3434,7 +3438,7 @@ Variable creatureFlourishWeapon(const vector<Variable> &args, const RoutineConte
     return Variable::ofNull();
 }
 
-Variable changeObjectAppearance(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable changeObjectAppearance(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
     int appearance = getInt(args, 1);
 
@@ -3443,11 +3447,11 @@ Variable changeObjectAppearance(const vector<Variable> &args, const RoutineConte
     return Variable::ofNull();
 }
 
-Variable getIsXBox(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIsXBox(const ArgumentSpan &args, const RoutineContext &ctx) {
     return Variable::ofInt(R_FALSE);
 }
 
-Variable playOverlayAnimation(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable playOverlayAnimation(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto target = getObject(args, 0, ctx);
     int animation = getInt(args, 1);
 
@@ -3456,13 +3460,13 @@ Variable playOverlayAnimation(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable unlockAllSongs(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable unlockAllSongs(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofNull();
 }
 
-Variable disableMap(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable disableMap(const ArgumentSpan &args, const RoutineContext &ctx) {
     bool flag = getIntAsBoolOrElse(args, 0, false);
 
     // TODO: implement
@@ -3470,7 +3474,7 @@ Variable disableMap(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable detonateMine(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable detonateMine(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto mine = getObject(args, 0, ctx);
 
     // TODO: implement
@@ -3478,7 +3482,7 @@ Variable detonateMine(const vector<Variable> &args, const RoutineContext &ctx) {
     return Variable::ofNull();
 }
 
-Variable disableHealthRegen(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable disableHealthRegen(const ArgumentSpan &args, const RoutineContext &ctx) {
     bool flag = getIntAsBoolOrElse(args, 0, false);
 
     // TODO: implement
@@ -3486,7 +3490,7 @@ Variable disableHealthRegen(const vector<Variable> &args, const RoutineContext &
     return Variable::ofNull();
 }
 
-Variable setCurrentForm(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setCurrentForm(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
     int formID = getInt(args, 1);
 
@@ -3495,7 +3499,7 @@ Variable setCurrentForm(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable setDisableTransit(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setDisableTransit(const ArgumentSpan &args, const RoutineContext &ctx) {
     bool flag = getIntAsBoolOrElse(args, 0, false);
 
     // TODO: implement
@@ -3503,7 +3507,7 @@ Variable setDisableTransit(const vector<Variable> &args, const RoutineContext &c
     return Variable::ofNull();
 }
 
-Variable setInputClass(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setInputClass(const ArgumentSpan &args, const RoutineContext &ctx) {
     int clazz = getInt(args, 0);
 
     // TODO: implement
@@ -3511,7 +3515,7 @@ Variable setInputClass(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable setForceAlwaysUpdate(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable setForceAlwaysUpdate(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
     int flag = getInt(args, 1);
 
@@ -3520,7 +3524,7 @@ Variable setForceAlwaysUpdate(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable displayMessageBox(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable displayMessageBox(const ArgumentSpan &args, const RoutineContext &ctx) {
     int strRef = getInt(args, 0);
     string icon = getStringOrElse(args, 1, "");
 
@@ -3529,7 +3533,7 @@ Variable displayMessageBox(const vector<Variable> &args, const RoutineContext &c
     return Variable::ofNull();
 }
 
-Variable displayDatapad(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable displayDatapad(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto datapad = getObject(args, 0, ctx);
 
     // TODO: implement
@@ -3537,15 +3541,15 @@ Variable displayDatapad(const vector<Variable> &args, const RoutineContext &ctx)
     return Variable::ofNull();
 }
 
-Variable removeHeartbeat(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable removeHeartbeat(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto placeable = getObject(args, 0, ctx);
 
-    // TODO: implement
+    ctx.game.removeHeartbeat(placeable->id());
 
     return Variable::ofNull();
 }
 
-Variable removeEffectByID(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable removeEffectByID(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
     int effectID = getInt(args, 1);
 
@@ -3554,7 +3558,7 @@ Variable removeEffectByID(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofNull();
 }
 
-Variable removeEffectByExactMatch(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable removeEffectByExactMatch(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObjectAsCreature(args, 0, ctx);
     auto effect = getEffect(args, 1);
 
@@ -3563,7 +3567,7 @@ Variable removeEffectByExactMatch(const vector<Variable> &args, const RoutineCon
     return Variable::ofNull();
 }
 
-Variable adjustCreatureSkills(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable adjustCreatureSkills(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
     auto skill = getIntAsEnum<SkillType>(args, 1);
     int amount = getInt(args, 2);
@@ -3573,7 +3577,7 @@ Variable adjustCreatureSkills(const vector<Variable> &args, const RoutineContext
     return Variable::ofNull();
 }
 
-Variable getSkillRankBase(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getSkillRankBase(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto skill = getIntAsEnum<SkillType>(args, 0);
     auto object = getObjectOrCaller(args, 1, ctx);
 
@@ -3582,7 +3586,7 @@ Variable getSkillRankBase(const vector<Variable> &args, const RoutineContext &ct
     return Variable::ofInt(0);
 }
 
-Variable enableRendering(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable enableRendering(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto object = getObject(args, 0, ctx);
     bool enable = getIntAsBool(args, 1);
 
@@ -3591,7 +3595,7 @@ Variable enableRendering(const vector<Variable> &args, const RoutineContext &ctx
     return Variable::ofNull();
 }
 
-Variable getCombatActionsPending(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getCombatActionsPending(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto creature = getObject(args, 0, ctx);
 
     // TODO: implement
@@ -3599,7 +3603,7 @@ Variable getCombatActionsPending(const vector<Variable> &args, const RoutineCont
     return Variable::ofInt(R_FALSE);
 }
 
-Variable getIsPlayerMadeCharacter(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable getIsPlayerMadeCharacter(const ArgumentSpan &args, const RoutineContext &ctx) {
     auto character = getObject(args, 0, ctx);
 
     // TODO: implement
@@ -3607,7 +3611,7 @@ Variable getIsPlayerMadeCharacter(const vector<Variable> &args, const RoutineCon
     return Variable::ofInt(R_FALSE);
 }
 
-Variable rebuildPartyTable(const vector<Variable> &args, const RoutineContext &ctx) {
+Variable rebuildPartyTable(const ArgumentSpan &args, const RoutineContext &ctx) {
     // TODO: implement
 
     return Variable::ofNull();
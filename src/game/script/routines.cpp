@@ -1761,7 +1761,7 @@ void Routines::add(
     string name,
     VariableType retType,
     vector<VariableType> argTypes,
-    Variable (*fn)(const vector<Variable> &args, const RoutineContext &ctx)) {
+    Variable (*fn)(const ArgumentSpan &args, const RoutineContext &ctx)) {
 
     Variable defRetValue;
     defRetValue.type = retType;
@@ -1782,7 +1782,10 @@ void Routines::add(
         move(defRetValue),
         move(argTypes),
         [this, fn](auto &args, auto &execution) {
-            RoutineContext ctx(_game, _services, execution);
+            if (!_game || !_services) {
+                throw logic_error("Routines were created without game");
+            }
+            RoutineContext ctx(*_game, *_services, execution);
             return fn(args, std::move(ctx));
         });
 }
@@ -1791,7 +1794,7 @@ void Routines::add(
     string name,
     VariableType retType,
     vector<VariableType> argTypes,
-    Variable (*fn)(const vector<Variable> &args, const RoutineContext &ctx),
+    Variable (*fn)(const ArgumentSpan &args, const RoutineContext &ctx),
     Variable defRetValue) {
 
     _routines.emplace_back(
@@ -1800,7 +1803,10 @@ void Routines::add(
         move(defRetValue),
         move(argTypes),
         [this, fn](auto &args, auto &execution) {
-            RoutineContext ctx(_game, _services, execution);
+            if (!_game || !_services) {
+                throw logic_error("Routines were created without game");
+            }
+            RoutineContext ctx(*_game, *_services, execution);
             return fn(args, std::move(ctx));
         });
 }
@@ -33,10 +33,18 @@ class Game;
 
 class Routines : public script::IRoutines {
 public:
+    /**
+     * Creates routines, that can only be used as a source of signatures.
+     * Calling such routines throws an exception.
+     */
+    Routines(GameID gameId) :
+        _gameId(gameId) {
+    }
+
     Routines(GameID gameId, Game &game, ServicesView &services) :
         _gameId(gameId),
-        _game(game),
-        _services(services) {
+        _game(&game),
+        _services(&services) {
     }
 
     void init();
@@ -48,8 +56,8 @@ public:
 
 private:
     GameID _gameId;
-    Game &_game;
-    ServicesView &_services;
+    Game *_game {nullptr};
+    ServicesView *_services {nullptr};
 
     std::vector<script::Routine> _routines;
 
@@ -60,13 +68,13 @@ private:
         std::string name,
         script::VariableType retType,
         std::vector<script::VariableType> argTypes,
-        script::Variable (*fn)(const std::vector<script::Variable> &args, const RoutineContext &ctx));
+        script::Variable (*fn)(const script::ArgumentSpan &args, const RoutineContext &ctx));
 
     void add(
         std::string name,
         script::VariableType retType,
         std::vector<script::VariableType> argTypes,
-        script::Variable (*fn)(const std::vector<script::Variable> &args, const RoutineContext &ctx),
+        script::Variable (*fn)(const script::ArgumentSpan &args, const RoutineContext &ctx),
         script::Variable defRetValue);
 };
 
@@ -19,6 +19,7 @@
 
 #include "../../script/execution.h"
 #include "../../script/executioncontext.h"
+#include "../../script/executionstate.h"
 #include "../../script/routines.h"
 #include "../../script/scripts.h"
 
@@ -33,6 +34,80 @@ namespace reone {
 namespace game {
 
 int ScriptRunner::run(const string &resRef, uint32_t callerId, uint32_t triggerrerId, int userDefinedEventNumber, int scriptVar) {
+    auto program = _scripts.get(resRef);
+    if (!program)
+        return -1;
+
+    auto ctx = newContext(callerId, triggerrerId, userDefinedEventNumber, scriptVar);
+    auto execution = acquireExecution(move(program), move(ctx));
+    int result = execution->run();
+    releaseExecution(move(execution));
+
+    return result;
+}
+
+int ScriptRunner::runAction(const ExecutionContext &action, uint32_t callerId) {
+    if (!action.savedState) {
+        throw invalid_argument("Action has no saved state");
+    }
+    auto ctx = make_unique<ExecutionContext>(action);
+    ctx->callerId = callerId;
+
+    auto execution = acquireExecution(action.savedState->program, move(ctx));
+    int result = execution->run();
+    releaseExecution(move(execution));
+
+    return result;
+}
+
+void ScriptRunner::runSliced(const string &resRef, uint32_t callerId, uint32_t triggerrerId) {
+    auto program = _scripts.get(resRef);
+    if (!program)
+        return;
+
+    auto ctx = newContext(callerId, triggerrerId, -1, -1);
+    auto execution = acquireExecution(move(program), move(ctx));
+    if (_instructionBudget > 0 && (_budgetLeft == 0 || !_suspended.empty())) {
+        // Preserve order of execution
+        _suspended.push_back(move(execution));
+        return;
+    }
+    runSlice(move(execution));
+}
+
+void ScriptRunner::update() {
+    _budgetLeft = _instructionBudget;
+
+    int numSuspended = static_cast<int>(_suspended.size());
+    for (int i = 0; i < numSuspended && (_instructionBudget == 0 || _budgetLeft > 0); ++i) {
+        auto execution = move(_suspended.front());
+        _suspended.pop_front();
+        runSlice(move(execution));
+    }
+}
+
+void ScriptRunner::clear() {
+    while (!_suspended.empty()) {
+        releaseExecution(move(_suspended.front()));
+        _suspended.pop_front();
+    }
+}
+
+void ScriptRunner::runSlice(unique_ptr<ScriptExecution> execution) {
+    int64_t executedBefore = execution->instructionsExecuted();
+    bool finished = execution->runSlice(_budgetLeft);
+    if (_instructionBudget > 0) {
+        int executed = static_cast<int>(execution->instructionsExecuted() - executedBefore);
+        _budgetLeft = max(0, _budgetLeft - executed);
+    }
+    if (finished) {
+        releaseExecution(move(execution));
+    } else {
+        _suspended.push_front(move(execution));
+    }
+}
+
+unique_ptr<ExecutionContext> ScriptRunner::newContext(uint32_t callerId, uint32_t triggerrerId, int userDefinedEventNumber, int scriptVar) {
     if (callerId == kObjectSelf) {
         throw invalid_argument("Invalid callerId");
     }
@@ -40,18 +115,30 @@ int ScriptRunner::run(const string &resRef, uint32_t callerId, uint32_t triggerr
         throw invalid_argument("Invalid triggerrerId");
     }
 
-    auto program = _scripts.get(resRef);
-    if (!program)
-        return -1;
-
     auto ctx = make_unique<ExecutionContext>();
     ctx->routines = &_routines;
+    ctx->profiler = _profiler;
     ctx->callerId = callerId;
     ctx->triggererId = triggerrerId;
     ctx->userDefinedEventNumber = userDefinedEventNumber;
     ctx->scriptVar = scriptVar;
 
-    return ScriptExecution(program, move(ctx)).run();
+    return move(ctx);
+}
+
+unique_ptr<ScriptExecution> ScriptRunner::acquireExecution(shared_ptr<ScriptProgram> program, unique_ptr<ExecutionContext> context) {
+    if (_pool.empty()) {
+        return make_unique<ScriptExecution>(move(program), move(context));
+    }
+    auto execution = move(_pool.back());
+    _pool.pop_back();
+    execution->reset(move(program), move(context));
+
+    return move(execution);
+}
+
+void ScriptRunner::releaseExecution(unique_ptr<ScriptExecution> execution) {
+    _pool.push_back(move(execution));
 }
 
 } // namespace game
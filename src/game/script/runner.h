@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include "../../script/execution.h"
+#include "../../script/executioncontext.h"
 #include "../../script/types.h"
 
 namespace reone {
@@ -24,17 +26,20 @@ namespace reone {
 namespace script {
 
 class IRoutines;
+class ScriptProfiler;
+class ScriptProgram;
 class Scripts;
 
 } // namespace script
 
 namespace game {
 
-class ScriptRunner {
+class ScriptRunner : boost::noncopyable {
 public:
-    ScriptRunner(script::IRoutines &routines, script::Scripts &scripts) :
+    ScriptRunner(script::IRoutines &routines, script::Scripts &scripts, script::ScriptProfiler *profiler = nullptr) :
         _routines(routines),
-        _scripts(scripts) {
+        _scripts(scripts),
+        _profiler(profiler) {
     }
 
     int run(
@@ -44,9 +49,60 @@ public:
         int userDefinedEventNumber = -1,
         int scriptVar = -1);
 
+    /**
+     * Resumes execution of an action, e.g. one passed to DelayCommand, on
+     * behalf of the specified caller.
+     */
+    int runAction(const script::ExecutionContext &action, uint32_t callerId);
+
+    // Time slicing
+
+    /**
+     * Runs a script within the instruction budget left for the current
+     * frame. A script that exceeds it is suspended and resumed on subsequent
+     * frames.
+     */
+    void runSliced(
+        const std::string &resRef,
+        uint32_t callerId = script::kObjectInvalid,
+        uint32_t triggerrerId = script::kObjectInvalid);
+
+    /**
+     * Starts a new frame, resuming suspended scripts in order of suspension.
+     */
+    void update();
+
+    /**
+     * Discards suspended scripts, e.g. on module change.
+     */
+    void clear();
+
+    /**
+     * @param budget maximum number of instructions executed by sliced scripts per frame, 0 is unlimited
+     */
+    void setInstructionBudget(int budget) {
+        _instructionBudget = budget;
+    }
+
+    // END Time slicing
+
 private:
     script::IRoutines &_routines;
     script::Scripts &_scripts;
+    script::ScriptProfiler *_profiler;
+
+    int _instructionBudget {0};
+    int _budgetLeft {0};
+
+    std::deque<std::unique_ptr<script::ScriptExecution>> _suspended;
+    std::vector<std::unique_ptr<script::ScriptExecution>> _pool; /**< finished executions available for reuse */
+
+    std::unique_ptr<script::ExecutionContext> newContext(uint32_t callerId, uint32_t triggerrerId, int userDefinedEventNumber, int scriptVar);
+
+    std::unique_ptr<script::ScriptExecution> acquireExecution(std::shared_ptr<script::ScriptProgram> program, std::unique_ptr<script::ExecutionContext> context);
+    void releaseExecution(std::unique_ptr<script::ScriptExecution> execution);
+
+    void runSlice(std::unique_ptr<script::ScriptExecution> execution);
 };
 
 } // namespace game
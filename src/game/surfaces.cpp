@@ -19,9 +19,11 @@
 
 #include "../../resource/2da.h"
 #include "../../resource/2das.h"
+#include "../common/logutil.h"
 
 using namespace std;
 
+using namespace reone::graphics;
 using namespace reone::resource;
 
 namespace reone {
@@ -41,8 +43,17 @@ void Surfaces::init() {
         surface.lineOfSight = surfacemat->getBool(row, "lineofsight");
         surface.grass = surfacemat->getBool(row, "grass");
         surface.sound = surfacemat->getString(row, "sound");
+        if (row < kMaxWalkmeshMaterials) {
+            _grassSurfaces.set(row, surface.grass);
+            _walkableSurfaces.set(row, surface.walk);
+            _walkcheckSurfaces.set(row, surface.walkcheck);
+            _lineOfSightSurfaces.set(row, surface.lineOfSight);
+        }
         _surfaces.push_back(move(surface));
     }
+    if (surfacemat->getRowCount() > kMaxWalkmeshMaterials) {
+        warn("Surface materials beyond " + to_string(kMaxWalkmeshMaterials) + " are ignored by walkmesh queries");
+    }
 }
 
 bool Surfaces::isWalkable(int index) const {
@@ -59,32 +70,6 @@ const Surface &Surfaces::getSurface(int index) const {
     return _surfaces[index];
 }
 
-set<uint32_t> Surfaces::getSurfaceIndices(const function<bool(const Surface &)> &pred) const {
-    set<uint32_t> result;
-    for (size_t i = 0; i < _surfaces.size(); ++i) {
-        if (pred(_surfaces[i])) {
-            result.insert(static_cast<uint32_t>(i));
-        }
-    }
-    return move(result);
-}
-
-set<uint32_t> Surfaces::getGrassSurfaces() const {
-    return getSurfaceIndices([](auto &surface) { return surface.grass; });
-}
-
-set<uint32_t> Surfaces::getWalkableSurfaces() const {
-    return getSurfaceIndices([](auto &surface) { return surface.walk; });
-}
-
-set<uint32_t> Surfaces::getWalkcheckSurfaces() const {
-    return getSurfaceIndices([](auto &surface) { return surface.walkcheck; });
-}
-
-set<uint32_t> Surfaces::getLineOfSightSurfaces() const {
-    return getSurfaceIndices([](auto &surface) { return surface.lineOfSight; });
-}
-
 } // namespace game
 
 } // namespace reone
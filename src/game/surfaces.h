@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include "../graphics/types.h"
+
 #include "surface.h"
 
 namespace reone {
@@ -41,17 +43,20 @@ public:
 
     const Surface &getSurface(int index) const;
 
-    std::set<uint32_t> getGrassSurfaces() const;
-    std::set<uint32_t> getWalkableSurfaces() const;
-    std::set<uint32_t> getWalkcheckSurfaces() const;
-    std::set<uint32_t> getLineOfSightSurfaces() const;
+    const graphics::SurfaceMask &getGrassSurfaces() const { return _grassSurfaces; }
+    const graphics::SurfaceMask &getWalkableSurfaces() const { return _walkableSurfaces; }
+    const graphics::SurfaceMask &getWalkcheckSurfaces() const { return _walkcheckSurfaces; }
+    const graphics::SurfaceMask &getLineOfSightSurfaces() const { return _lineOfSightSurfaces; }
 
 private:
     resource::TwoDas &_twoDas;
 
     std::vector<Surface> _surfaces;
 
-    inline std::set<uint32_t> getSurfaceIndices(const std::function<bool(const Surface &)> &pred) const;
+    graphics::SurfaceMask _grassSurfaces;
+    graphics::SurfaceMask _walkableSurfaces;
+    graphics::SurfaceMask _walkcheckSurfaces;
+    graphics::SurfaceMask _lineOfSightSurfaces;
 };
 
 } // namespace game
@@ -42,18 +42,28 @@ public:
     }
 
     bool getByTime(float time, V &value) const {
+        int cursor = 0;
+        return getByTime(time, value, cursor);
+    }
+
+    /**
+     * @param cursor index of the keyframe found by the previous lookup on this
+     *               property, updated on return. When time advances
+     *               monotonically, lookup resumes from it in constant time.
+     */
+    bool getByTime(float time, V &value, int &cursor) const {
         if (_frames.empty())
             return false;
 
+        int frameIdx = findFrame(time, cursor);
+        cursor = frameIdx;
+
         const std::pair<float, V> *frame1 = &_frames[0];
         const std::pair<float, V> *frame2 = &_frames[0];
-        for (auto it = _frames.begin(); it != _frames.end(); ++it) {
-            if (it->first >= time) {
-                frame2 = &*it;
-                if (it != _frames.begin()) {
-                    frame1 = &*(it - 1);
-                }
-                break;
+        if (frameIdx < static_cast<int>(_frames.size())) {
+            frame2 = &_frames[frameIdx];
+            if (frameIdx > 0) {
+                frame1 = &_frames[frameIdx - 1];
             }
         }
 
@@ -89,6 +99,23 @@ public:
 
 private:
     std::vector<std::pair<float, V>> _frames;
+
+    /**
+     * @return index of the first keyframe at or after time, or number of keyframes if there is none
+     */
+    int findFrame(float time, int cursor) const {
+        int numFrames = static_cast<int>(_frames.size());
+        for (int frameIdx = cursor; frameIdx >= 0 && frameIdx <= numFrames && frameIdx <= cursor + 1; ++frameIdx) {
+            if ((frameIdx == 0 || _frames[frameIdx - 1].first < time) &&
+                (frameIdx == numFrames || _frames[frameIdx].first >= time)) {
+                return frameIdx;
+            }
+        }
+        auto it = std::lower_bound(_frames.begin(), _frames.end(), time, [](auto &frame, float time) {
+            return frame.first < time;
+        });
+        return static_cast<int>(std::distance(_frames.begin(), it));
+    }
 };
 
 } // namespace graphics
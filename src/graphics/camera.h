@@ -65,6 +65,24 @@ public:
         return false;
     }
 
+    /**
+     * Conservative test, suitable for large AABBs: false only if AABB is
+     * entirely behind one of the frustum planes.
+     */
+    bool intersectFrustum(const AABB &aabb) const {
+        for (auto &plane : {_frustumLeft, _frustumRight, _frustumBottom, _frustumTop, _frustumNear, _frustumFar}) {
+            glm::vec4 positive(
+                plane.x >= 0.0f ? aabb.max().x : aabb.min().x,
+                plane.y >= 0.0f ? aabb.max().y : aabb.min().y,
+                plane.z >= 0.0f ? aabb.max().z : aabb.min().z,
+                1.0f);
+            if (glm::dot(plane, positive) < 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     CameraType type() const { return _type; }
     const glm::mat4 &projection() const { return _projection; }
     const glm::mat4 &view() const { return _view; }
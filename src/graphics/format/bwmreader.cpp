@@ -17,6 +17,8 @@
 
 #include "bwmreader.h"
 
+#include "../../common/exception/validation.h"
+
 #include "../walkmesh.h"
 
 using namespace std;
@@ -25,6 +27,44 @@ namespace reone {
 
 namespace graphics {
 
+static void buildAABBNodes(
+    const vector<Walkmesh::Face> &faces,
+    const vector<glm::vec3> &centroids,
+    vector<int>::iterator begin,
+    vector<int>::iterator end,
+    vector<Walkmesh::AABBNode> &nodes) {
+
+    AABB bounds;
+    AABB centroidBounds;
+    for (auto it = begin; it != end; ++it) {
+        for (auto &vertex : faces[*it].vertices) {
+            bounds.expand(vertex);
+        }
+        centroidBounds.expand(centroids[*it]);
+    }
+    int nodeIdx = static_cast<int>(nodes.size());
+    auto node = Walkmesh::AABBNode();
+    node.min = bounds.min();
+    node.max = bounds.max();
+    nodes.push_back(move(node));
+
+    if (distance(begin, end) == 1) {
+        nodes[nodeIdx].faceIdx = *begin;
+        return;
+    }
+
+    // Split faces in halves by centroid, along the longest axis
+    auto size = centroidBounds.size();
+    int axis = size.x >= size.y && size.x >= size.z ? 0 : (size.y >= size.z ? 1 : 2);
+    auto mid = begin + distance(begin, end) / 2;
+    nth_element(begin, mid, end, [&centroids, axis](int left, int right) {
+        return centroids[left][axis] < centroids[right][axis];
+    });
+    buildAABBNodes(faces, centroids, begin, mid, nodes);
+    nodes[nodeIdx].rightIdx = static_cast<int>(nodes.size());
+    buildAABBNodes(faces, centroids, mid, end, nodes);
+}
+
 void BwmReader::onLoad() {
     checkSignature(string("BWM V1.0", 8));
 
@@ -89,6 +129,8 @@ void BwmReader::onLoad() {
 
     if (_type == WalkmeshType::WOK) {
         loadAABB();
+    } else {
+        buildAABB();
     }
 }
 
@@ -135,10 +177,13 @@ void BwmReader::loadNormals() {
 }
 
 void BwmReader::loadAABB() {
+    if (_numAabb == 0) {
+        return;
+    }
     seek(_offAabb);
 
-    vector<shared_ptr<Walkmesh::AABB>> aabbs;
-    aabbs.resize(_numAabb);
+    vector<Walkmesh::AABBNode> fileNodes;
+    fileNodes.resize(_numAabb);
 
     vector<pair<uint32_t, uint32_t>> aabbChildren;
     aabbChildren.resize(_numAabb);
@@ -151,24 +196,56 @@ void BwmReader::loadAABB() {
         uint32_t childIdx1 = readUint32();
         uint32_t childIdx2 = readUint32();
 
-        aabbs[i] = make_shared<Walkmesh::AABB>();
-        aabbs[i]->value = AABB(glm::make_vec3(&bounds[0]), glm::make_vec3(&bounds[3]));
-        aabbs[i]->faceIdx = faceIdx;
+        fileNodes[i].min = glm::make_vec3(&bounds[0]);
+        fileNodes[i].max = glm::make_vec3(&bounds[3]);
+        fileNodes[i].faceIdx = faceIdx;
 
         aabbChildren[i] = make_pair(childIdx1, childIdx2);
     }
 
-    for (uint32_t i = 0; i < _numAabb; ++i) {
-        if (aabbs[i]->faceIdx != -1) {
-            continue;
+    // Reorder nodes depth-first, so that left child of every inner node immediately follows it
+
+    vector<Walkmesh::AABBNode> nodes;
+    nodes.reserve(_numAabb);
+
+    stack<pair<uint32_t, int>> fileIndices; // file index and index of parent, whose right child it is
+    fileIndices.push(make_pair(0, -1));
+    while (!fileIndices.empty()) {
+        auto [fileIdx, parentIdx] = fileIndices.top();
+        fileIndices.pop();
+        if (fileIdx >= _numAabb || nodes.size() >= _numAabb) {
+            throw ValidationException("Invalid AABB tree");
+        }
+        int nodeIdx = static_cast<int>(nodes.size());
+        if (parentIdx != -1) {
+            nodes[parentIdx].rightIdx = nodeIdx;
+        }
+        nodes.push_back(fileNodes[fileIdx]);
+        if (!nodes.back().isLeaf()) {
+            fileIndices.push(make_pair(aabbChildren[fileIdx].second, nodeIdx));
+            fileIndices.push(make_pair(aabbChildren[fileIdx].first, -1));
         }
-        uint32_t childIdx1 = aabbChildren[i].first;
-        uint32_t childIdx2 = aabbChildren[i].second;
-        aabbs[i]->left = aabbs[childIdx1];
-        aabbs[i]->right = aabbs[childIdx2];
     }
 
-    _walkmesh->_rootAabb = aabbs[0];
+    _walkmesh->_aabbNodes = move(nodes);
+}
+
+void BwmReader::buildAABB() {
+    if (_numFaces == 0) {
+        return;
+    }
+    vector<int> faceIndices(_numFaces);
+    vector<glm::vec3> centroids;
+    centroids.reserve(_numFaces);
+    for (uint32_t i = 0; i < _numFaces; ++i) {
+        faceIndices[i] = static_cast<int>(i);
+        auto &vertices = _walkmesh->_faces[i].vertices;
+        centroids.push_back((vertices[0] + vertices[1] + vertices[2]) / 3.0f);
+    }
+    vector<Walkmesh::AABBNode> nodes;
+    nodes.reserve(2 * _numFaces - 1);
+    buildAABBNodes(_walkmesh->_faces, centroids, faceIndices.begin(), faceIndices.end(), nodes);
+    _walkmesh->_aabbNodes = move(nodes);
 }
 
 } // namespace graphics
@@ -68,6 +68,11 @@ private:
     void loadMaterials();
     void loadNormals();
     void loadAABB();
+
+    /**
+     * Builds AABB tree for walkmeshes that do not store one, i.e. PWK and DWK.
+     */
+    void buildAABB();
 };
 
 } // namespace graphics
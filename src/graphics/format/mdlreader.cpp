@@ -693,7 +693,7 @@ void MdlReader::readControllers(uint32_t keyOffset, uint32_t keyCount, const vec
         if (fn) {
             fn(key, data, node);
         } else {
-            debug(boost::format("Unsupported MDL controller type: %d") % static_cast<int>(key.type), LogChannels::graphics);
+            R_DEBUG(boost::format("Unsupported MDL controller type: %d") % static_cast<int>(key.type), LogChannels::graphics);
         }
     }
 }
@@ -24,26 +24,30 @@ namespace reone {
 namespace graphics {
 
 bool LipAnimation::getKeyframes(float time, uint8_t &leftShape, uint8_t &rightShape, float &factor) const {
+    int cursor = 0;
+    return getKeyframes(time, leftShape, rightShape, factor, cursor);
+}
+
+bool LipAnimation::getKeyframes(float time, uint8_t &leftShape, uint8_t &rightShape, float &factor, int &cursor) const {
     if (_keyframes.empty())
         return false;
 
+    int frameIdx = findKeyframe(time, cursor);
+    cursor = frameIdx;
+
     const Keyframe *left = &_keyframes[0];
     const Keyframe *right = &_keyframes[0];
-
-    for (auto &frame : _keyframes) {
-        if (time > frame.time) {
-            left = &frame;
-        }
-        if (time <= frame.time) {
-            right = &frame;
-            break;
-        }
+    if (frameIdx > 0) {
+        left = &_keyframes[frameIdx - 1];
+    }
+    if (frameIdx < static_cast<int>(_keyframes.size())) {
+        right = &_keyframes[frameIdx];
     }
 
     leftShape = left->shape;
     rightShape = right->shape;
 
-    if (&left == &right) {
+    if (left == right) {
         factor = 0.0f;
     } else {
         factor = (time - left->time) / (right->time - left->time);
@@ -52,6 +56,23 @@ bool LipAnimation::getKeyframes(float time, uint8_t &leftShape, uint8_t &rightSh
     return true;
 }
 
+int LipAnimation::findKeyframe(float time, int cursor) const {
+    // Resume from the previous keyframe, when time advances monotonically
+    int numKeyframes = static_cast<int>(_keyframes.size());
+    for (int frameIdx = cursor; frameIdx >= 0 && frameIdx <= numKeyframes && frameIdx <= cursor + 1; ++frameIdx) {
+        if ((frameIdx == 0 || _keyframes[frameIdx - 1].time < time) &&
+            (frameIdx == numKeyframes || _keyframes[frameIdx].time >= time)) {
+            return frameIdx;
+        }
+    }
+
+    // Otherwise, find the first keyframe at or after time using binary search
+    auto it = lower_bound(_keyframes.begin(), _keyframes.end(), time, [](auto &frame, float time) {
+        return frame.time < time;
+    });
+    return static_cast<int>(distance(_keyframes.begin(), it));
+}
+
 } // namespace graphics
 
 } // namespace reone
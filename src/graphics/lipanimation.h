@@ -36,6 +36,11 @@ public:
 
     bool getKeyframes(float time, uint8_t &leftShape, uint8_t &rightShape, float &factor) const;
 
+    /**
+     * @param cursor index of the keyframe found by the previous lookup, updated on return
+     */
+    bool getKeyframes(float time, uint8_t &leftShape, uint8_t &rightShape, float &factor, int &cursor) const;
+
     const std::string &name() const { return _name; }
     float length() const { return _length; }
     const std::vector<Keyframe> &keyframes() const { return _keyframes; }
@@ -44,6 +49,8 @@ private:
     std::string _name;
     float _length;
     std::vector<Keyframe> _keyframes;
+
+    int findKeyframe(float time, int cursor) const;
 };
 
 } // namespace graphics
@@ -20,6 +20,7 @@
 #include "../common/exception/validation.h"
 #include "../common/logutil.h"
 #include "../common/stream/bytearrayinput.h"
+#include "../common/traceutil.h"
 #include "../resource/resources.h"
 
 #include "format/mdlreader.h"
@@ -58,6 +59,8 @@ shared_ptr<Model> Models::get(const string &resRef) {
 }
 
 shared_ptr<Model> Models::doGet(const string &resRef) {
+    R_TRACE_ZONE("Models::doGet");
+
     debug("Load model " + resRef, LogChannels::graphics);
 
     shared_ptr<ByteArray> mdlData(_resources.get(resRef, ResourceType::Mdl));
@@ -38,6 +38,11 @@ constexpr int kMaxGrassClusters = 256;
 constexpr int kMaxWalkmeshMaterials = 64;
 constexpr int kMaxPoints = 128;
 
+/**
+ * Set of surface materials, one bit per row of surfacemat 2DA.
+ */
+typedef std::bitset<kMaxWalkmeshMaterials> SurfaceMask;
+
 /**
  * This is a hint to the engine when configuring texture properties.
  */
@@ -24,84 +24,213 @@ namespace reone {
 namespace graphics {
 
 const Walkmesh::Face *Walkmesh::raycast(
-    set<uint32_t> surfaces,
+    const SurfaceMask &surfaces,
     const glm::vec3 &origin,
     const glm::vec3 &dir,
     float maxDistance,
     float &outDistance) const {
 
-    // For area walkmeshes, find intersection via AABB tree
-    if (_rootAabb) {
+    // Find intersection via AABB tree, if present
+    if (!_aabbNodes.empty()) {
         return raycastAABB(surfaces, origin, dir, maxDistance, outDistance);
     }
 
-    // For placeable and door walkmeshes, test all faces for intersection
-    glm::vec2 baryPosition(0.0f);
+    // Otherwise, test all faces for intersection
+    const Face *closestFace = nullptr;
     float distance = 0.0f;
     for (auto &face : _faces) {
         if (raycastFace(surfaces, face, origin, dir, maxDistance, distance)) {
-            outDistance = distance;
-            return &face;
+            closestFace = &face;
+            maxDistance = distance;
         }
     }
+    if (closestFace) {
+        outDistance = maxDistance;
+    }
 
-    return nullptr;
+    return closestFace;
 }
 
 const Walkmesh::Face *Walkmesh::raycastAABB(
-    set<uint32_t> surfaces,
+    const SurfaceMask &surfaces,
     const glm::vec3 &origin,
     const glm::vec3 &dir,
     float maxDistance,
     float &outDistance) const {
 
-    float distance = 0.0f;
+    auto invDir = 1.0f / dir;
 
-    stack<AABB *> aabbs;
-    aabbs.push(_rootAabb.get());
+    float distance = 0.0f;
+    if (!raycastAABBNode(_aabbNodes[0], origin, invDir, maxDistance, distance)) {
+        return nullptr;
+    }
 
-    auto invDir = 1.0f / dir;
+    // Traverse the tree front to back, pruning nodes farther than the closest intersection found so far
+    const Face *closestFace = nullptr;
+    vector<pair<int, float>> nodes;
+    nodes.reserve(32);
+    nodes.push_back(make_pair(0, distance));
 
-    while (!aabbs.empty()) {
-        auto aabb = aabbs.top();
-        aabbs.pop();
+    while (!nodes.empty()) {
+        auto [nodeIdx, entryDistance] = nodes.back();
+        nodes.pop_back();
+        if (entryDistance >= maxDistance) {
+            continue;
+        }
 
         // Test ray/face intersection for tree leafs
-        if (aabb->faceIdx != -1) {
-            const Face &face = _faces[aabb->faceIdx];
+        auto &node = _aabbNodes[nodeIdx];
+        if (node.isLeaf()) {
+            const Face &face = _faces[node.faceIdx];
             if (raycastFace(surfaces, face, origin, dir, maxDistance, distance)) {
-                outDistance = distance;
-                return &face;
+                closestFace = &face;
+                maxDistance = distance;
             }
             continue;
         }
 
-        // Test ray/AABB intersection
-        if (!aabb->value.raycast(origin, invDir, maxDistance, distance)) {
-            continue;
+        // Test ray/AABB intersection for child nodes, push the nearest child last
+        int leftIdx = nodeIdx + 1;
+        int rightIdx = node.rightIdx;
+        float leftDistance = 0.0f;
+        float rightDistance = 0.0f;
+        bool leftHit = raycastAABBNode(_aabbNodes[leftIdx], origin, invDir, maxDistance, leftDistance);
+        bool rightHit = raycastAABBNode(_aabbNodes[rightIdx], origin, invDir, maxDistance, rightDistance);
+        if (leftHit && rightHit) {
+            if (leftDistance < rightDistance) {
+                nodes.push_back(make_pair(rightIdx, rightDistance));
+                nodes.push_back(make_pair(leftIdx, leftDistance));
+            } else {
+                nodes.push_back(make_pair(leftIdx, leftDistance));
+                nodes.push_back(make_pair(rightIdx, rightDistance));
+            }
+        } else if (leftHit) {
+            nodes.push_back(make_pair(leftIdx, leftDistance));
+        } else if (rightHit) {
+            nodes.push_back(make_pair(rightIdx, rightDistance));
         }
+    }
+    if (closestFace) {
+        outDistance = maxDistance;
+    }
+
+    return closestFace;
+}
+
+void Walkmesh::raycast(
+    const SurfaceMask &surfaces,
+    const vector<Ray> &rays,
+    vector<const Face *> &outFaces,
+    vector<float> &outDistances) const {
+
+    outFaces.assign(rays.size(), nullptr);
+    outDistances.resize(rays.size());
+    for (size_t i = 0; i < rays.size(); ++i) {
+        outDistances[i] = rays[i].maxDistance;
+    }
+    float distance = 0.0f;
+
+    // Without AABB tree, test all faces for intersection
+    if (_aabbNodes.empty()) {
+        for (auto &face : _faces) {
+            for (size_t i = 0; i < rays.size(); ++i) {
+                if (raycastFace(surfaces, face, rays[i].origin, rays[i].dir, outDistances[i], distance)) {
+                    outFaces[i] = &face;
+                    outDistances[i] = distance;
+                }
+            }
+        }
+        return;
+    }
 
-        // Find intersection with child AABB nodes
-        if (aabb->left) {
-            aabbs.push(aabb->left.get());
+    // Scratch buffers are reused between calls
+    auto &invDirs = _invDirs;
+    auto &rayIndices = _rayIndices;
+    auto &nodes = _nodeRays;
+
+    invDirs.clear();
+    for (auto &ray : rays) {
+        invDirs.push_back(1.0f / ray.dir);
+    }
+
+    // Traverse the tree once, carrying indices of rays that intersect the parent node.
+    // Indices are appended to a shared buffer: segment of a node stays valid until its
+    // subtree has been processed, and is discarded when the next sibling is popped.
+    rayIndices.clear();
+    for (size_t i = 0; i < rays.size(); ++i) {
+        rayIndices.push_back(static_cast<int>(i));
+    }
+    nodes.clear();
+    nodes.push_back(NodeRays {0, 0, rays.size()});
+
+    while (!nodes.empty()) {
+        auto parentRays = nodes.back();
+        nodes.pop_back();
+        rayIndices.resize(parentRays.end);
+
+        // Keep rays that intersect this node closer than their closest intersection so far
+        auto &node = _aabbNodes[parentRays.nodeIdx];
+        size_t begin = rayIndices.size();
+        for (size_t i = parentRays.begin; i < parentRays.end; ++i) {
+            int rayIdx = rayIndices[i];
+            if (raycastAABBNode(node, rays[rayIdx].origin, invDirs[rayIdx], outDistances[rayIdx], distance)) {
+                rayIndices.push_back(rayIdx);
+            }
         }
-        if (aabb->right) {
-            aabbs.push(aabb->right.get());
+        size_t end = rayIndices.size();
+        if (begin == end) {
+            continue;
         }
+
+        // Test ray/face intersection for tree leafs
+        if (node.isLeaf()) {
+            const Face &face = _faces[node.faceIdx];
+            for (size_t i = begin; i < end; ++i) {
+                int rayIdx = rayIndices[i];
+                if (raycastFace(surfaces, face, rays[rayIdx].origin, rays[rayIdx].dir, outDistances[rayIdx], distance)) {
+                    outFaces[rayIdx] = &face;
+                    outDistances[rayIdx] = distance;
+                }
+            }
+            continue;
+        }
+
+        nodes.push_back(NodeRays {node.rightIdx, begin, end});
+        nodes.push_back(NodeRays {parentRays.nodeIdx + 1, begin, end});
+    }
+}
+
+bool Walkmesh::raycastAABBNode(
+    const AABBNode &node,
+    const glm::vec3 &origin,
+    const glm::vec3 &invDir,
+    float maxDistance,
+    float &outDistance) const {
+
+    glm::vec3 t1((node.min - origin) * invDir);
+    glm::vec3 t2((node.max - origin) * invDir);
+    glm::vec3 tNear(glm::min(t1, t2));
+    glm::vec3 tFar(glm::max(t1, t2));
+
+    float tmin = glm::max(0.0f, glm::max(tNear.x, glm::max(tNear.y, tNear.z)));
+    float tmax = glm::min(tFar.x, glm::min(tFar.y, tFar.z));
+    if (tmax < tmin || tmin >= maxDistance) {
+        return false;
     }
 
-    return nullptr;
+    outDistance = tmin;
+    return true;
 }
 
 bool Walkmesh::raycastFace(
-    set<uint32_t> surfaces,
+    const SurfaceMask &surfaces,
     const Face &face,
     const glm::vec3 &origin,
     const glm::vec3 &dir,
     float maxDistance,
     float &outDistance) const {
 
-    if (surfaces.count(face.material) == 0) {
+    if (face.material >= surfaces.size() || !surfaces[face.material]) {
         return false;
     }
 
@@ -121,10 +250,12 @@ bool Walkmesh::raycastFace(
 }
 
 bool Walkmesh::contains(const glm::vec2 &point) const {
-    if (!_rootAabb) {
+    if (_aabbNodes.empty()) {
         return false;
     }
-    return _rootAabb->value.contains(point);
+    auto &root = _aabbNodes[0];
+    return point.x >= root.min.x && point.x <= root.max.x &&
+           point.y >= root.min.y && point.y <= root.max.y;
 }
 
 } // namespace graphics
@@ -35,52 +35,103 @@ public:
         glm::vec3 normal {0.0f};
     };
 
-    struct AABB {
-        graphics::AABB value;
-        int faceIdx {-1};
-        std::shared_ptr<AABB> left;
-        std::shared_ptr<AABB> right;
+    /**
+     * Node of a flat AABB tree, stored in depth-first order. Left child of an
+     * inner node immediately follows it. Bounds are packed with indices into
+     * two 16-byte rows.
+     */
+    struct AABBNode {
+        glm::vec3 min {0.0f};
+        int faceIdx {-1}; /**< -1 for inner nodes */
+        glm::vec3 max {0.0f};
+        int rightIdx {-1}; /**< -1 for leaf nodes */
+
+        bool isLeaf() const { return faceIdx != -1; }
+    };
+
+    struct Ray {
+        glm::vec3 origin {0.0f};
+        glm::vec3 dir {0.0f};
+        float maxDistance {0.0f};
     };
 
     /**
-     * @return pointer to intersected face or nullptr, when no intersection
+     * @return pointer to the closest intersected face or nullptr, when no intersection
      */
     const Walkmesh::Face *raycast(
-        std::set<uint32_t> walkcheckSurfaces,
+        const SurfaceMask &surfaces,
         const glm::vec3 &origin,
         const glm::vec3 &dir,
         float maxDistance,
         float &outDistance) const;
 
+    /**
+     * Batched version of raycast. AABB tree is traversed once for all rays.
+     * Not thread-safe, as scratch buffers are reused between calls.
+     *
+     * @param outFaces pointers to the closest intersected faces, nullptr for rays without intersection
+     * @param outDistances distances to the closest intersections
+     */
+    void raycast(
+        const SurfaceMask &surfaces,
+        const std::vector<Ray> &rays,
+        std::vector<const Face *> &outFaces,
+        std::vector<float> &outDistances) const;
+
     bool contains(const glm::vec2 &point) const;
 
     bool isAreaWalkmesh() const { return _area; }
 
     const std::vector<Face> &faces() const { return _faces; }
+    const std::vector<AABBNode> &aabbNodes() const { return _aabbNodes; }
 
     void add(Face &&face) {
         _faces.push_back(face);
     }
 
-    void setRootAABB(std::shared_ptr<AABB> aabb) {
-        _rootAabb = std::move(aabb);
+    void setAABBNodes(std::vector<AABBNode> nodes) {
+        _aabbNodes = std::move(nodes);
     }
 
 private:
+    /**
+     * Node of the AABB tree with a range of indices of rays intersecting its parent.
+     */
+    struct NodeRays {
+        int nodeIdx {0};
+        size_t begin {0};
+        size_t end {0};
+    };
+
     std::vector<Face> _faces;
-    std::shared_ptr<AABB> _rootAabb;
+    std::vector<AABBNode> _aabbNodes;
 
     bool _area {false};
 
+    // Batched raycasting
+
+    mutable std::vector<glm::vec3> _invDirs;
+    mutable std::vector<int> _rayIndices;
+    mutable std::vector<NodeRays> _nodeRays;
+
+    // END Batched raycasting
+
     const Walkmesh::Face *raycastAABB(
-        std::set<uint32_t> surfaces,
+        const SurfaceMask &surfaces,
         const glm::vec3 &origin,
         const glm::vec3 &dir,
         float maxDistance,
         float &outDistance) const;
 
+    bool raycastAABBNode(
+        const AABBNode &node,
+        const glm::vec3 &origin,
+        const glm::vec3 &invDir,
+        float maxDistance,
+        float &outDistance) const;
+
     bool raycastFace(
-        std::set<uint32_t> surfaces,
+        const SurfaceMask &surfaces,
         const Walkmesh::Face &face,
         const glm::vec3 &origin,
         const glm::vec3 &dir,
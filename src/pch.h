@@ -19,7 +19,10 @@
 
 #include <algorithm>
 #include <atomic>
+#include <bitset>
+#include <chrono>
 #include <climits>
+#include <condition_variable>
 #include <cstdarg>
 #include <cstdint>
 #include <cstdlib>
@@ -27,6 +30,7 @@
 #include <ctime>
 #include <deque>
 #include <functional>
+#include <future>
 #include <iomanip>
 #include <iostream>
 #include <istream>
@@ -20,6 +20,7 @@
 #include "../common/logutil.h"
 #include "../common/pathutil.h"
 #include "../common/stream/fileinput.h"
+#include "../common/traceutil.h"
 
 #include "format/bifreader.h"
 #include "format/erfreader.h"
@@ -103,6 +104,8 @@ void Resources::clearTransientProviders() {
 }
 
 shared_ptr<ByteArray> Resources::get(const string &resRef, ResourceType type, bool logNotFound) {
+    R_TRACE_ZONE("Resources::get");
+
     if (resRef.empty()) {
         return nullptr;
     }
@@ -136,7 +139,7 @@ shared_ptr<ByteArray> Resources::getFromProviders(const ResourceId &id, const ve
     for (auto provider = providers.rbegin(); provider != providers.rend(); ++provider) {
         shared_ptr<ByteArray> data((*provider)->find(id));
         if (data) {
-            debug(boost::format("Resource '%s' found in provider %d") % id.string() % (*provider)->id(), LogChannels::resources2);
+            R_DEBUG(boost::format("Resource '%s' found in provider %d") % id.string() % (*provider)->id(), LogChannels::resources2);
             return data;
         }
     }
@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "aabbtree.h"
+
+using namespace std;
+
+using namespace reone::graphics;
+
+namespace reone {
+
+namespace scene {
+
+static constexpr float kAABBMargin = 1.0f;
+
+static AABB getFatAABB(const AABB &aabb) {
+    return AABB(aabb.min() - kAABBMargin, aabb.max() + kAABBMargin);
+}
+
+static AABB getUnion(const AABB &left, const AABB &right) {
+    AABB aabb(left);
+    aabb.expand(right);
+    return move(aabb);
+}
+
+static float getSurfaceArea(const AABB &aabb) {
+    auto size = aabb.size();
+    return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+}
+
+int AABBTree::insert(const AABB &aabb, void *user) {
+    int proxyId = allocateNode();
+    auto &node = _nodes[proxyId];
+    node.aabb = getFatAABB(aabb);
+    node.user = user;
+    node.height = 0;
+    insertLeaf(proxyId);
+    ++_numProxies;
+
+    return proxyId;
+}
+
+void AABBTree::remove(int proxyId) {
+    removeLeaf(proxyId);
+    freeNode(proxyId);
+    --_numProxies;
+}
+
+bool AABBTree::move(int proxyId, const AABB &aabb) {
+    auto &fatAABB = _nodes[proxyId].aabb;
+    if (fatAABB.contains(aabb.min()) && fatAABB.contains(aabb.max())) {
+        return false;
+    }
+    removeLeaf(proxyId);
+    _nodes[proxyId].aabb = getFatAABB(aabb);
+    insertLeaf(proxyId);
+
+    return true;
+}
+
+void AABBTree::clear() {
+    _nodes.clear();
+    _root = -1;
+    _freeList = -1;
+    _numProxies = 0;
+}
+
+int AABBTree::allocateNode() {
+    if (_freeList == -1) {
+        _nodes.push_back(Node());
+        return static_cast<int>(_nodes.size()) - 1;
+    }
+    int index = _freeList;
+    _freeList = _nodes[index].parent;
+    _nodes[index] = Node();
+    return index;
+}
+
+void AABBTree::freeNode(int index) {
+    _nodes[index] = Node();
+    _nodes[index].parent = _freeList;
+    _freeList = index;
+}
+
+void AABBTree::insertLeaf(int leaf) {
+    if (_root == -1) {
+        _root = leaf;
+        _nodes[leaf].parent = -1;
+        return;
+    }
+
+    // Find the best sibling for the new leaf, using surface area heuristic
+
+    auto leafAABB = _nodes[leaf].aabb;
+    int index = _root;
+    while (!_nodes[index].isLeaf()) {
+        auto &node = _nodes[index];
+        float area = getSurfaceArea(node.aabb);
+        float combinedArea = getSurfaceArea(getUnion(node.aabb, leafAABB));
+
+        // Cost of making a new parent for this node and the new leaf
+        float cost = 2.0f * combinedArea;
+
+        // Minimum cost of pushing the new leaf further down the tree
+        float inheritanceCost = 2.0f * (combinedArea - area);
+        auto getDescendCost = [&](int child) {
+            auto &childNode = _nodes[child];
+            float childCombinedArea = getSurfaceArea(getUnion(childNode.aabb, leafAABB));
+            if (childNode.isLeaf()) {
+                return childCombinedArea + inheritanceCost;
+            } else {
+                return childCombinedArea - getSurfaceArea(childNode.aabb) + inheritanceCost;
+            }
+        };
+        float leftCost = getDescendCost(node.left);
+        float rightCost = getDescendCost(node.right);
+
+        if (cost < leftCost && cost < rightCost) {
+            break;
+        }
+        index = leftCost < rightCost ? node.left : node.right;
+    }
+
+    // Create a new parent for the sibling and the new leaf
+
+    int sibling = index;
+    int oldParent = _nodes[sibling].parent;
+    int newParent = allocateNode();
+    auto &parentNode = _nodes[newParent];
+    parentNode.parent = oldParent;
+    parentNode.aabb = getUnion(leafAABB, _nodes[sibling].aabb);
+    parentNode.left = sibling;
+    parentNode.right = leaf;
+    parentNode.height = _nodes[sibling].height + 1;
+    _nodes[sibling].parent = newParent;
+    _nodes[leaf].parent = newParent;
+
+    if (oldParent == -1) {
+        _root = newParent;
+    } else if (_nodes[oldParent].left == sibling) {
+        _nodes[oldParent].left = newParent;
+    } else {
+        _nodes[oldParent].right = newParent;
+    }
+
+    refitAncestors(newParent);
+}
+
+void AABBTree::removeLeaf(int leaf) {
+    if (leaf == _root) {
+        _root = -1;
+        return;
+    }
+    int parent = _nodes[leaf].parent;
+    int grandParent = _nodes[parent].parent;
+    int sibling = _nodes[parent].left == leaf ? _nodes[parent].right : _nodes[parent].left;
+
+    // Replace parent with the sibling
+    _nodes[sibling].parent = grandParent;
+    if (grandParent == -1) {
+        _root = sibling;
+    } else if (_nodes[grandParent].left == parent) {
+        _nodes[grandParent].left = sibling;
+    } else {
+        _nodes[grandParent].right = sibling;
+    }
+    freeNode(parent);
+
+    refitAncestors(grandParent);
+}
+
+void AABBTree::refitAncestors(int index) {
+    while (index != -1) {
+        index = balance(index);
+        auto &node = _nodes[index];
+        auto &left = _nodes[node.left];
+        auto &right = _nodes[node.right];
+        node.height = 1 + max(left.height, right.height);
+        node.aabb = getUnion(left.aabb, right.aabb);
+        index = node.parent;
+    }
+}
+
+int AABBTree::balance(int index) {
+    auto &a = _nodes[index];
+    if (a.isLeaf() || a.height < 2) {
+        return index;
+    }
+    int bIdx = a.left;
+    int cIdx = a.right;
+    auto &b = _nodes[bIdx];
+    auto &c = _nodes[cIdx];
+    int heightDiff = c.height - b.height;
+
+    // Rotate the higher child up, make node its child. Of the grandchildren,
+    // the higher one stays with the rotated child, the lower one goes to node.
+    auto rotateUp = [&](int upIdx, Node &up, int otherIdx, Node &other, bool upIsRight) {
+        int fIdx = up.left;
+        int gIdx = up.right;
+        auto &f = _nodes[fIdx];
+        auto &g = _nodes[gIdx];
+
+        up.left = index;
+        up.parent = a.parent;
+        a.parent = upIdx;
+        if (up.parent == -1) {
+            _root = upIdx;
+        } else if (_nodes[up.parent].left == index) {
+            _nodes[up.parent].left = upIdx;
+        } else {
+            _nodes[up.parent].right = upIdx;
+        }
+
+        int keptIdx = f.height > g.height ? fIdx : gIdx;
+        int movedIdx = f.height > g.height ? gIdx : fIdx;
+        auto &kept = _nodes[keptIdx];
+        auto &moved = _nodes[movedIdx];
+        up.right = keptIdx;
+        if (upIsRight) {
+            a.right = movedIdx;
+        } else {
+            a.left = movedIdx;
+        }
+        moved.parent = index;
+        a.aabb = getUnion(other.aabb, moved.aabb);
+        a.height = 1 + max(other.height, moved.height);
+        up.aabb = getUnion(a.aabb, kept.aabb);
+        up.height = 1 + max(a.height, kept.height);
+    };
+
+    if (heightDiff > 1) {
+        rotateUp(cIdx, c, bIdx, b, true);
+        return cIdx;
+    }
+    if (heightDiff < -1) {
+        rotateUp(bIdx, b, cIdx, c, false);
+        return bIdx;
+    }
+
+    return index;
+}
+
+} // namespace scene
+
+} // namespace reone
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../graphics/aabb.h"
+
+namespace reone {
+
+namespace scene {
+
+/**
+ * Dynamic bounding volume hierarchy. Leaves store AABBs enlarged by a margin,
+ * so that small movements do not require reinsertion. Insertion picks the
+ * sibling using the surface area heuristic, tree is kept balanced by
+ * rotations.
+ */
+class AABBTree : boost::noncopyable {
+public:
+    /**
+     * @return id of the created proxy
+     */
+    int insert(const graphics::AABB &aabb, void *user);
+
+    void remove(int proxyId);
+
+    /**
+     * @return true if proxy had to be reinserted, false if its enlarged AABB still contains aabb
+     */
+    bool move(int proxyId, const graphics::AABB &aabb);
+
+    void clear();
+
+    /**
+     * Visits user data of every leaf, such that test passes for the enlarged
+     * AABB of the leaf and AABBs of all of its ancestors.
+     *
+     * @param test function, that takes a const graphics::AABB reference and returns bool
+     * @param visit function, that takes a void pointer to user data
+     */
+    template <class Test, class Visit>
+    void query(Test test, Visit visit) const {
+        if (_root == -1) {
+            return;
+        }
+        std::vector<int> stack;
+        stack.reserve(64);
+        stack.push_back(_root);
+        while (!stack.empty()) {
+            auto &node = _nodes[stack.back()];
+            stack.pop_back();
+            if (!test(node.aabb)) {
+                continue;
+            }
+            if (node.isLeaf()) {
+                visit(node.user);
+            } else {
+                stack.push_back(node.left);
+                stack.push_back(node.right);
+            }
+        }
+    }
+
+    int numProxies() const { return _numProxies; }
+    int height() const { return _root != -1 ? _nodes[_root].height : 0; }
+
+    void *user(int proxyId) const { return _nodes[proxyId].user; }
+    const graphics::AABB &aabb(int proxyId) const { return _nodes[proxyId].aabb; }
+
+private:
+    struct Node {
+        graphics::AABB aabb;
+        void *user {nullptr};
+        int parent {-1}; /**< next free node, if this node is free */
+        int left {-1};
+        int right {-1};
+        int height {-1}; /**< 0 for leaves, -1 for free nodes */
+
+        bool isLeaf() const { return left == -1; }
+    };
+
+    std::vector<Node> _nodes;
+    int _root {-1};
+    int _freeList {-1};
+    int _numProxies {0};
+
+    int allocateNode();
+    void freeNode(int index);
+
+    void insertLeaf(int leaf);
+    void removeLeaf(int leaf);
+
+    void refitAncestors(int index);
+    int balance(int index);
+};
+
+} // namespace scene
+
+} // namespace reone
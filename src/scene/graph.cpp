@@ -18,6 +18,7 @@
 #include "graph.h"
 
 #include "../audio/services.h"
+#include "../common/traceutil.h"
 #include "../graphics/context.h"
 #include "../graphics/mesh.h"
 #include "../graphics/meshes.h"
@@ -64,14 +65,35 @@ static constexpr float kMaxCollisionDistanceLineOfSight2 = kMaxCollisionDistance
 
 void SceneGraph::clear() {
     _modelRoots.clear();
+    _modelRootTree.clear();
+    _modelRootProxies.clear();
+    _movedModelRoots.clear();
     _walkmeshRoots.clear();
     _soundRoots.clear();
     _grassRoots.clear();
     _activeLights.clear();
 }
 
+static AABB getWorldAABB(const SceneNode &node) {
+    auto &transform = node.absoluteTransform();
+    if (node.aabb().isEmpty()) {
+        auto origin = node.getOrigin();
+        return AABB(origin, origin);
+    }
+    auto center = glm::vec3(transform * glm::vec4(node.aabb().center(), 1.0f));
+    auto halfSize = 0.5f * node.aabb().size();
+    auto halfExtent =
+        glm::abs(glm::vec3(transform[0])) * halfSize.x +
+        glm::abs(glm::vec3(transform[1])) * halfSize.y +
+        glm::abs(glm::vec3(transform[2])) * halfSize.z;
+
+    return AABB(center - halfExtent, center + halfExtent);
+}
+
 void SceneGraph::addRoot(ModelSceneNode &node) {
-    _modelRoots.insert(&node);
+    if (_modelRoots.insert(&node).second) {
+        _modelRootProxies.insert(make_pair(&node, _modelRootTree.insert(getWorldAABB(node), &node)));
+    }
 }
 
 void SceneGraph::addRoot(WalkmeshSceneNode &node) {
@@ -104,6 +126,13 @@ void SceneGraph::removeRoot(ModelSceneNode &node) {
     }
 
     _modelRoots.erase(&node);
+
+    auto maybeProxy = _modelRootProxies.find(&node);
+    if (maybeProxy != _modelRootProxies.end()) {
+        _modelRootTree.remove(maybeProxy->second);
+        _modelRootProxies.erase(maybeProxy);
+    }
+    _movedModelRoots.erase(&node);
 }
 
 void SceneGraph::removeRoot(WalkmeshSceneNode &node) {
@@ -122,8 +151,17 @@ void SceneGraph::removeRoot(SoundSceneNode &node) {
     _soundRoots.erase(&node);
 }
 
+void SceneGraph::invalidateRootBounds(ModelSceneNode &node) {
+    if (_modelRootProxies.count(&node) > 0) {
+        _movedModelRoots.insert(&node);
+    }
+}
+
 void SceneGraph::update(float dt) {
+    R_TRACE_ZONE("SceneGraph::update");
+
     if (_updateRoots) {
+        R_TRACE_ZONE("SceneGraph::updateRoots");
         for (auto &root : _modelRoots) {
             root->update(dt);
         }
@@ -137,6 +175,7 @@ void SceneGraph::update(float dt) {
     if (!_activeCamera) {
         return;
     }
+    refitRoots();
     cullRoots();
     refresh();
     updateLighting();
@@ -147,15 +186,34 @@ void SceneGraph::update(float dt) {
     prepareTransparentLeafs();
 }
 
+void SceneGraph::refitRoots() {
+    for (auto &root : _movedModelRoots) {
+        _modelRootTree.move(_modelRootProxies.find(root)->second, getWorldAABB(*root));
+    }
+    _movedModelRoots.clear();
+}
+
 void SceneGraph::cullRoots() {
-    for (auto &root : _modelRoots) {
-        bool culled =
-            !root->isEnabled() ||
-            root->getSquareDistanceTo(*_activeCamera) > root->drawDistance() * root->drawDistance() ||
-            (root->isCullable() && !_activeCamera->isInFrustum(*root));
+    R_TRACE_ZONE("SceneGraph::cullRoots");
 
-        root->setCulled(culled);
+    auto isCulledByDistance = [this](const ModelSceneNode &root) {
+        return !root.isEnabled() ||
+               root.getSquareDistanceTo(*_activeCamera) > root.drawDistance() * root.drawDistance();
+    };
+
+    // Cullable roots are culled, unless found in the view frustum
+    for (auto &root : _modelRoots) {
+        root->setCulled(root->isCullable() || isCulledByDistance(*root));
     }
+    auto camera = _activeCamera->camera();
+    _modelRootTree.query(
+        [&camera](const AABB &aabb) { return camera->intersectFrustum(aabb); },
+        [&](void *user) {
+            auto root = static_cast<ModelSceneNode *>(user);
+            if (root->isCullable()) {
+                root->setCulled(isCulledByDistance(*root) || !_activeCamera->isInFrustum(*root));
+            }
+        });
 }
 
 void SceneGraph::updateLighting() {
@@ -273,6 +331,8 @@ void SceneGraph::updateSounds() {
 }
 
 void SceneGraph::refresh() {
+    R_TRACE_ZONE("SceneGraph::refresh");
+
     _opaqueMeshes.clear();
     _transparentMeshes.clear();
     _shadowMeshes.clear();
@@ -430,7 +490,7 @@ void SceneGraph::drawOpaque() {
     if (_drawWalkmeshes || _drawTriggers) {
         _graphicsSvc.uniforms.setWalkmesh([this](auto &walkmesh) {
             for (int i = 0; i < kMaxWalkmeshMaterials - 1; ++i) {
-                walkmesh.materials[i] = _walkableSurfaces.count(i) > 0 ? glm::vec4(0.0f, 1.0f, 0.0f, 1.0f) : glm::vec4(1.0f, 0.0f, 0.0f, 1.0f);
+                walkmesh.materials[i] = _walkableSurfaces[i] ? glm::vec4(0.0f, 1.0f, 0.0f, 1.0f) : glm::vec4(1.0f, 0.0f, 0.0f, 1.0f);
             }
             walkmesh.materials[kMaxWalkmeshMaterials - 1] = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f); // triggers
         });
@@ -547,7 +607,7 @@ bool SceneGraph::testElevation(const glm::vec2 &position, Collision &outCollisio
         float distance = 0.0f;
         auto face = root->walkmesh().raycast(_walkcheckSurfaces, objSpaceOrigin, down, 2.0f * kElevationTestZ, distance);
         if (face) {
-            if (_walkableSurfaces.count(face->material) == 0) {
+            if (face->material >= _walkableSurfaces.size() || !_walkableSurfaces[face->material]) {
                 // non-walkable
                 return false;
             }
@@ -562,6 +622,84 @@ bool SceneGraph::testElevation(const glm::vec2 &position, Collision &outCollisio
     return false;
 }
 
+void SceneGraph::testElevations(const vector<glm::vec2> &positions, vector<bool> &outResults, vector<Collision> &outCollisions) const {
+    static glm::vec3 down(0.0f, 0.0f, -1.0f);
+
+    outResults.assign(positions.size(), false);
+    outCollisions.resize(positions.size());
+
+    // Scratch buffers are reused between calls
+    auto &pending = _elevationPending;
+    auto &resolved = _elevationResolved;
+    auto &rays = _elevationRays;
+    auto &rayPositions = _elevationRayPositions;
+    auto &faces = _elevationFaces;
+    auto &distances = _elevationDistances;
+
+    pending.resize(positions.size());
+    for (size_t i = 0; i < positions.size(); ++i) {
+        pending[i] = i;
+    }
+    resolved.assign(positions.size(), false);
+
+    for (auto &root : _walkmeshRoots) {
+        if (pending.empty()) {
+            break;
+        }
+        if (!root->isEnabled()) {
+            continue;
+        }
+        auto &walkmesh = root->walkmesh();
+
+        // Transform rays of unresolved positions into walkmesh object space
+        rays.clear();
+        rayPositions.clear();
+        auto &absTransformInv = root->absoluteTransformInverse();
+        for (auto positionIdx : pending) {
+            auto &position = positions[positionIdx];
+            if (!walkmesh.isAreaWalkmesh()) {
+                float distance2 = root->getSquareDistanceTo2D(position);
+                if (distance2 > kMaxCollisionDistanceWalk2) {
+                    continue;
+                }
+            }
+            Walkmesh::Ray ray;
+            ray.origin = glm::vec3(absTransformInv * glm::vec4(position, kElevationTestZ, 1.0f));
+            ray.dir = down;
+            ray.maxDistance = 2.0f * kElevationTestZ;
+            rays.push_back(move(ray));
+            rayPositions.push_back(positionIdx);
+        }
+        if (rays.empty()) {
+            continue;
+        }
+        walkmesh.raycast(_walkcheckSurfaces, rays, faces, distances);
+
+        // First walkmesh intersected by a ray determines the result
+        for (size_t i = 0; i < rays.size(); ++i) {
+            auto face = faces[i];
+            if (!face) {
+                continue;
+            }
+            size_t positionIdx = rayPositions[i];
+            resolved[positionIdx] = true;
+            if (face->material >= _walkableSurfaces.size() || !_walkableSurfaces[face->material]) {
+                // non-walkable
+                continue;
+            }
+            auto &collision = outCollisions[positionIdx];
+            collision.user = root->user();
+            collision.intersection = glm::vec3(positions[positionIdx], kElevationTestZ) + distances[i] * down;
+            collision.normal = root->absoluteTransform() * glm::vec4(face->normal, 0.0f);
+            collision.material = face->material;
+            outResults[positionIdx] = true;
+        }
+        pending.erase(
+            remove_if(pending.begin(), pending.end(), [&resolved](size_t positionIdx) { return resolved[positionIdx]; }),
+            pending.end());
+    }
+}
+
 bool SceneGraph::testLineOfSight(const glm::vec3 &origin, const glm::vec3 &dest, Collision &outCollision) const {
     glm::vec3 originToDest(dest - origin);
     glm::vec3 dir(glm::normalize(originToDest));
@@ -581,8 +719,8 @@ bool SceneGraph::testLineOfSight(const glm::vec3 &origin, const glm::vec3 &dest,
         glm::vec3 objSpaceOrigin(root->absoluteTransformInverse() * glm::vec4(origin, 1.0f));
         glm::vec3 objSpaceDir(root->absoluteTransformInverse() * glm::vec4(dir, 0.0f));
         float distance = 0.0f;
-        auto face = root->walkmesh().raycast(_lineOfSightSurfaces, objSpaceOrigin, objSpaceDir, maxDistance, distance);
-        if (!face || distance > minDistance) {
+        auto face = root->walkmesh().raycast(_lineOfSightSurfaces, objSpaceOrigin, objSpaceDir, glm::min(maxDistance, minDistance), distance);
+        if (!face) {
             continue;
         }
         outCollision.user = root->user();
@@ -614,8 +752,8 @@ bool SceneGraph::testWalk(const glm::vec3 &origin, const glm::vec3 &dest, const
         glm::vec3 objSpaceOrigin(root->absoluteTransformInverse() * glm::vec4(origin, 1.0f));
         glm::vec3 objSpaceDir(root->absoluteTransformInverse() * glm::vec4(dir, 0.0f));
         float distance = 0.0f;
-        auto face = root->walkmesh().raycast(_walkcheckSurfaces, objSpaceOrigin, objSpaceDir, kMaxCollisionDistanceWalk, distance);
-        if (!face || distance > maxDistance || distance > minDistance) {
+        auto face = root->walkmesh().raycast(_walkcheckSurfaces, objSpaceOrigin, objSpaceDir, glm::min(kMaxCollisionDistanceWalk, minDistance), distance);
+        if (!face || distance > maxDistance) {
             continue;
         }
         outCollision.user = root->user();
@@ -639,25 +777,33 @@ ModelSceneNode *SceneGraph::pickModelAt(int x, int y, IUser *except) const {
     glm::vec3 end(glm::unProject(glm::vec3(x, _graphicsOpt.height - y, 1.0f), camera->view(), camera->projection(), viewport));
     glm::vec3 dir(glm::normalize(end - start));
 
+    glm::vec3 invDir(1.0f / dir);
+
     vector<pair<ModelSceneNode *, float>> distances;
-    for (auto &model : _modelRoots) {
-        if (!model->isPickable() || model->user() == except) {
-            continue;
-        }
-        if (model->getSquareDistanceTo(start) > kMaxCollisionDistanceLineOfSight2) {
-            continue;
-        }
-        auto objSpaceStart = model->absoluteTransformInverse() * glm::vec4(start, 1.0f);
-        auto objSpaceInvDir = 1.0f / (model->absoluteTransformInverse() * glm::vec4(dir, 0.0f));
-        float distance;
-        if (model->aabb().raycast(objSpaceStart, objSpaceInvDir, kMaxCollisionDistanceLineOfSight, distance) && distance > 0.0f) {
-            Collision collision;
-            if (testLineOfSight(start, start + distance * dir, collision) && collision.user != model->user()) {
-                continue;
+    _modelRootTree.query(
+        [&](const AABB &aabb) {
+            float distance;
+            return aabb.raycast(start, invDir, kMaxCollisionDistanceLineOfSight, distance);
+        },
+        [&](void *user) {
+            auto model = static_cast<ModelSceneNode *>(user);
+            if (!model->isPickable() || model->user() == except) {
+                return;
             }
-            distances.push_back(make_pair(model, distance));
-        }
-    }
+            if (model->getSquareDistanceTo(start) > kMaxCollisionDistanceLineOfSight2) {
+                return;
+            }
+            auto objSpaceStart = model->absoluteTransformInverse() * glm::vec4(start, 1.0f);
+            auto objSpaceInvDir = 1.0f / (model->absoluteTransformInverse() * glm::vec4(dir, 0.0f));
+            float distance;
+            if (model->aabb().raycast(objSpaceStart, objSpaceInvDir, kMaxCollisionDistanceLineOfSight, distance) && distance > 0.0f) {
+                Collision collision;
+                if (testLineOfSight(start, start + distance * dir, collision) && collision.user != model->user()) {
+                    return;
+                }
+                distances.push_back(make_pair(model, distance));
+            }
+        });
     if (distances.empty()) {
         return nullptr;
     }
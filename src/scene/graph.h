@@ -19,6 +19,7 @@
 
 #include "../graphics/scene.h"
 
+#include "aabbtree.h"
 #include "fogproperties.h"
 #include "node/camera.h"
 #include "node/dummy.h"
@@ -110,6 +111,12 @@ public:
     void removeRoot(GrassSceneNode &node);
     void removeRoot(SoundSceneNode &node);
 
+    /**
+     * Schedules refit of the model root in the bounding volume hierarchy.
+     * Ignored if node is not a model root.
+     */
+    void invalidateRootBounds(ModelSceneNode &node);
+
     // END Roots
 
     // Lighting
@@ -160,14 +167,24 @@ public:
     // Collision detection and object picking
 
     bool testElevation(const glm::vec2 &position, Collision &outCollision) const;
+
+    /**
+     * Batched version of testElevation. Each walkmesh is tested once per batch.
+     * Not thread-safe, as scratch buffers are reused between calls.
+     *
+     * @param outResults whether walkable elevation was found, per position
+     * @param outCollisions collisions, per position
+     */
+    void testElevations(const std::vector<glm::vec2> &positions, std::vector<bool> &outResults, std::vector<Collision> &outCollisions) const;
+
     bool testLineOfSight(const glm::vec3 &origin, const glm::vec3 &dest, Collision &outCollision) const;
     bool testWalk(const glm::vec3 &origin, const glm::vec3 &dest, const IUser *excludeUser, Collision &outCollision) const;
 
     virtual ModelSceneNode *pickModelAt(int x, int y, IUser *except = nullptr) const;
 
-    void setWalkableSurfaces(std::set<uint32_t> surfaces) { _walkableSurfaces = std::move(surfaces); }
-    void setWalkcheckSurfaces(std::set<uint32_t> surfaces) { _walkcheckSurfaces = std::move(surfaces); }
-    void setLineOfSightSurfaces(std::set<uint32_t> surfaces) { _lineOfSightSurfaces = std::move(surfaces); }
+    void setWalkableSurfaces(graphics::SurfaceMask surfaces) { _walkableSurfaces = std::move(surfaces); }
+    void setWalkcheckSurfaces(graphics::SurfaceMask surfaces) { _walkcheckSurfaces = std::move(surfaces); }
+    void setLineOfSightSurfaces(graphics::SurfaceMask surfaces) { _lineOfSightSurfaces = std::move(surfaces); }
 
     // END Collision detection and object picking
 
@@ -216,6 +233,10 @@ private:
     std::set<GrassSceneNode *> _grassRoots;
     std::set<SoundSceneNode *> _soundRoots;
 
+    AABBTree _modelRootTree;
+    std::unordered_map<ModelSceneNode *, int> _modelRootProxies;
+    std::set<ModelSceneNode *> _movedModelRoots;
+
     // END Roots
 
     // Leafs
@@ -256,12 +277,24 @@ private:
 
     // Surfaces
 
-    std::set<uint32_t> _walkableSurfaces;
-    std::set<uint32_t> _walkcheckSurfaces;
-    std::set<uint32_t> _lineOfSightSurfaces;
+    graphics::SurfaceMask _walkableSurfaces;
+    graphics::SurfaceMask _walkcheckSurfaces;
+    graphics::SurfaceMask _lineOfSightSurfaces;
 
     // END Surfaces
 
+    // Elevation testing
+
+    mutable std::vector<size_t> _elevationPending;
+    mutable std::vector<bool> _elevationResolved;
+    mutable std::vector<graphics::Walkmesh::Ray> _elevationRays;
+    mutable std::vector<size_t> _elevationRayPositions;
+    mutable std::vector<const graphics::Walkmesh::Face *> _elevationFaces;
+    mutable std::vector<float> _elevationDistances;
+
+    // END Elevation testing
+
+    void refitRoots();
     void cullRoots();
 
     void refresh();
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include "../graphics/types.h"
+
 namespace reone {
 
 namespace graphics {
@@ -31,7 +33,7 @@ struct GrassProperties {
     float density {0.0f};
     float quadSize {0.0f};
     glm::vec4 probabilities {0.0f};
-    std::set<uint32_t> materials;
+    graphics::SurfaceMask materials;
     graphics::Texture *texture {nullptr};
 };
 
@@ -24,43 +24,88 @@ namespace reone {
 namespace scene {
 
 void SceneNode::addChild(SceneNode &node) {
+    if (node._parent == this) {
+        return;
+    }
+    if (node._parent) {
+        node._parent->removeChild(node);
+    }
     node._parent = this;
-    node.computeAbsoluteTransforms();
-    _children.insert(&node);
+    node._childIndex = static_cast<int>(_children.size());
+    node.invalidateAbsoluteTransforms();
+    _children.push_back(&node);
 }
 
-void SceneNode::computeAbsoluteTransforms() {
-    if (_parent) {
-        _absTransform = _parent->_absTransform * _localTransform;
-    } else {
-        _absTransform = _localTransform;
+void SceneNode::removeChild(SceneNode &node) {
+    if (node._parent != this) {
+        return;
     }
-    _absTransformInv = glm::inverse(_absTransform);
+    // Swap with the last child and pop
+    auto last = _children.back();
+    _children[node._childIndex] = last;
+    last->_childIndex = node._childIndex;
+    _children.pop_back();
+
+    node._parent = nullptr;
+    node._childIndex = -1;
+    node.invalidateAbsoluteTransforms();
+}
 
+void SceneNode::removeAllChildren() {
     for (auto &child : _children) {
-        child->computeAbsoluteTransforms();
+        child->_parent = nullptr;
+        child->_childIndex = -1;
+        child->invalidateAbsoluteTransforms();
     }
-
-    onAbsoluteTransformChanged();
+    _children.clear();
 }
 
-void SceneNode::removeChild(SceneNode &node) {
-    auto maybeChild = _children.find(&node);
-    if (maybeChild == _children.end()) {
+void SceneNode::removeChildrenIf(const function<bool(SceneNode &)> &pred) {
+    auto newEnd = remove_if(_children.begin(), _children.end(), [&pred](SceneNode *child) {
+        if (!pred(*child)) {
+            return false;
+        }
+        child->_parent = nullptr;
+        child->_childIndex = -1;
+        child->invalidateAbsoluteTransforms();
+        return true;
+    });
+    if (newEnd == _children.end()) {
         return;
     }
-    auto child = *maybeChild;
-    child->_parent = nullptr;
-    child->computeAbsoluteTransforms();
-    _children.erase(maybeChild);
+    _children.erase(newEnd, _children.end());
+    for (size_t i = 0; i < _children.size(); ++i) {
+        _children[i]->_childIndex = static_cast<int>(i);
+    }
 }
 
-void SceneNode::removeAllChildren() {
+void SceneNode::invalidateAbsoluteTransforms() {
+    // Optimization: descendants of a dirty node are already dirty
+    if (_absTransformDirty) {
+        return;
+    }
+    _absTransformDirty = true;
+    _absTransformInvDirty = true;
+
     for (auto &child : _children) {
-        child->_parent = nullptr;
-        child->computeAbsoluteTransforms();
+        child->invalidateAbsoluteTransforms();
     }
-    _children.clear();
+
+    onAbsoluteTransformChanged();
+}
+
+void SceneNode::computeAbsoluteTransform() const {
+    if (_parent) {
+        _absTransform = _parent->absoluteTransform() * _localTransform;
+    } else {
+        _absTransform = _localTransform;
+    }
+    _absTransformDirty = false;
+}
+
+void SceneNode::computeAbsoluteTransformInverse() const {
+    _absTransformInv = glm::inverse(absoluteTransform());
+    _absTransformInvDirty = false;
 }
 
 void SceneNode::update(float dt) {
@@ -70,11 +115,11 @@ void SceneNode::update(float dt) {
 }
 
 glm::vec3 SceneNode::getOrigin() const {
-    return glm::vec3(_absTransform[3]);
+    return glm::vec3(absoluteTransform()[3]);
 }
 
 glm::vec2 SceneNode::getOrigin2D() const {
-    return glm::vec2(_absTransform[3]);
+    return glm::vec2(absoluteTransform()[3]);
 }
 
 float SceneNode::getDistanceTo(const glm::vec3 &point) const {
@@ -98,12 +143,12 @@ float SceneNode::getSquareDistanceTo2D(const glm::vec2 &point) const {
 }
 
 glm::vec3 SceneNode::getWorldCenterOfAABB() const {
-    return _absTransform * glm::vec4(_aabb.center(), 1.0f);
+    return absoluteTransform() * glm::vec4(_aabb.center(), 1.0f);
 }
 
 void SceneNode::setLocalTransform(glm::mat4 transform) {
     _localTransform = move(transform);
-    computeAbsoluteTransforms();
+    invalidateAbsoluteTransforms();
 }
 
 } // namespace scene
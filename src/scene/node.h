@@ -46,6 +46,11 @@ public:
     void removeChild(SceneNode &node);
     void removeAllChildren();
 
+    /**
+     * Removes children satisfying the predicate in a single pass.
+     */
+    void removeChildrenIf(const std::function<bool(SceneNode &)> &pred);
+
     virtual void update(float dt);
 
     virtual void drawLeafs(const std::vector<SceneNode *> &leafs) {
@@ -70,7 +75,7 @@ public:
     SceneNodeType type() const { return _type; }
     SceneNode *parent() { return _parent; }
     const SceneNode *parent() const { return _parent; }
-    const std::unordered_set<SceneNode *> &children() const { return _children; }
+    const std::vector<SceneNode *> &children() const { return _children; }
     const graphics::AABB &aabb() const { return _aabb; }
     IUser *user() { return _user; }
     const IUser *user() const { return _user; }
@@ -88,8 +93,20 @@ public:
     // Transformations
 
     const glm::mat4 &localTransform() const { return _localTransform; }
-    const glm::mat4 &absoluteTransform() const { return _absTransform; }
-    const glm::mat4 &absoluteTransformInverse() const { return _absTransformInv; }
+
+    const glm::mat4 &absoluteTransform() const {
+        if (_absTransformDirty) {
+            computeAbsoluteTransform();
+        }
+        return _absTransform;
+    }
+
+    const glm::mat4 &absoluteTransformInverse() const {
+        if (_absTransformInvDirty) {
+            computeAbsoluteTransformInverse();
+        }
+        return _absTransformInv;
+    }
 
     void setLocalTransform(glm::mat4 transform);
 
@@ -102,7 +119,8 @@ protected:
     audio::AudioServices &_audioSvc;
 
     SceneNode *_parent {nullptr};
-    std::unordered_set<SceneNode *> _children;
+    std::vector<SceneNode *> _children;
+    int _childIndex {-1}; /**< index of this node in children of its parent */
 
     graphics::AABB _aabb;
 
@@ -120,8 +138,15 @@ protected:
     // Transformations
 
     glm::mat4 _localTransform {1.0f};
-    glm::mat4 _absTransform {1.0f};
-    glm::mat4 _absTransformInv {1.0f};
+
+    /**
+     * Absolute transform and its inverse are computed lazily. When a node is
+     * dirty, so are all of its descendants.
+     */
+    mutable glm::mat4 _absTransform {1.0f};
+    mutable glm::mat4 _absTransformInv {1.0f};
+    mutable bool _absTransformDirty {false};
+    mutable bool _absTransformInvDirty {false};
 
     // END Transformations
 
@@ -136,7 +161,10 @@ protected:
         _audioSvc(audioSvc) {
     }
 
-    void computeAbsoluteTransforms();
+    void invalidateAbsoluteTransforms();
+
+    void computeAbsoluteTransform() const;
+    void computeAbsoluteTransformInverse() const;
 
     virtual void onAbsoluteTransformChanged() {}
 };
@@ -30,7 +30,7 @@ namespace scene {
 
 void CameraSceneNode::onAbsoluteTransformChanged() {
     if (_camera) {
-        _camera->setView(_absTransformInv);
+        _camera->setView(absoluteTransformInverse());
     }
 }
 
@@ -45,14 +45,14 @@ bool CameraSceneNode::isInFrustum(const SceneNode &other) const {
 void CameraSceneNode::setOrthographicProjection(float left, float right, float bottom, float top, float zNear, float zFar) {
     auto camera = make_unique<OrthographicCamera>();
     camera->setProjection(left, right, bottom, top, zNear, zFar);
-    camera->setView(_absTransformInv);
+    camera->setView(absoluteTransformInverse());
     _camera = move(camera);
 }
 
 void CameraSceneNode::setPerspectiveProjection(float fovy, float aspect, float zNear, float zFar) {
     auto camera = make_shared<PerspectiveCamera>();
     camera->setProjection(fovy, aspect, zNear, zFar);
-    camera->setView(_absTransformInv);
+    camera->setView(absoluteTransformInverse());
     _camera = move(camera);
 }
 
@@ -101,20 +101,17 @@ void EmitterSceneNode::removeExpiredParticles(float dt) {
     if (_lifeExpectancy == -1.0f) {
         return;
     }
-    vector<ParticleSceneNode *> expiredParticles;
-    for (auto &child : _children) {
-        if (child->type() != SceneNodeType::Particle) {
-            continue;
+    removeChildrenIf([this](SceneNode &child) {
+        if (child.type() != SceneNodeType::Particle) {
+            return false;
         }
-        auto particle = static_cast<ParticleSceneNode *>(child);
-        if (particle->isExpired()) {
-            expiredParticles.push_back(particle);
+        auto &particle = static_cast<ParticleSceneNode &>(child);
+        if (!particle.isExpired()) {
+            return false;
         }
-    }
-    for (auto &particle : expiredParticles) {
-        removeChild(*particle);
-        _particlePool.push_back(particle);
-    }
+        _particlePool.push_back(&particle);
+        return true;
+    });
 }
 
 void EmitterSceneNode::spawnParticles(float dt) {
@@ -185,7 +182,7 @@ void EmitterSceneNode::spawnLightningParticles() {
     float halfW = 0.005f * _size.x;
     float halfH = 0.005f * _size.y;
     glm::vec3 origin(random(-halfW, halfW), random(-halfH, halfH), 0.0f);
-    glm::vec3 emitterSpaceRefPos(_absTransformInv * glm::vec4((*ref)->getOrigin(), 1.0f));
+    glm::vec3 emitterSpaceRefPos(absoluteTransformInverse() * glm::vec4((*ref)->getOrigin(), 1.0f));
     glm::vec3 refToOrigin(emitterSpaceRefPos - origin);
     float distance = glm::abs(refToOrigin.z);
     float segmentLength = distance / static_cast<float>(_lightningSubDiv + 1);
@@ -228,7 +225,7 @@ void EmitterSceneNode::spawnLightningParticles() {
         glm::vec3 endToStart(segment.second - segment.first);
         glm::vec3 center(0.5f * (segment.first + segment.second));
         particle->setLocalTransform(glm::translate(center));
-        particle->setDir(_absTransform * glm::vec4(glm::normalize(endToStart), 0.0f));
+        particle->setDir(absoluteTransform() * glm::vec4(glm::normalize(endToStart), 0.0f));
         particle->setSize(glm::vec2(_lightningScale, glm::length(endToStart)));
 
         addChild(*particle);
@@ -248,9 +245,9 @@ void EmitterSceneNode::drawLeafs(const vector<SceneNode *> &leafs) {
     if (!texture) {
         return;
     }
-    auto emitterRight = glm::vec3(_absTransform[0]);
-    auto emitterUp = glm::vec3(_absTransform[1]);
-    auto emitterForward = glm::vec3(_absTransform[2]);
+    auto emitterRight = glm::vec3(absoluteTransform()[0]);
+    auto emitterUp = glm::vec3(absoluteTransform()[1]);
+    auto emitterForward = glm::vec3(absoluteTransform()[2]);
 
     auto view = _sceneGraph.activeCamera()->camera()->view();
     auto cameraRight = glm::vec3(view[0][0], view[1][0], view[2][0]);
@@ -51,7 +51,7 @@ void GrassSceneNode::init() {
     auto faces = _aabbNode.mesh()->mesh->faces();
     for (size_t faceIdx = 0; faceIdx < faces.size(); ++faceIdx) {
         auto &face = faces[faceIdx];
-        if (_properties.materials.count(face.material) == 0) {
+        if (face.material >= _properties.materials.size() || !_properties.materials[face.material]) {
             continue;
         }
         _grassFaces.push_back(static_cast<int>(faceIdx));
@@ -74,7 +74,7 @@ void GrassSceneNode::update(float dt) {
     auto mesh = _aabbNode.mesh()->mesh;
     auto &faces = mesh->faces();
     auto cameraPos = camera->getOrigin();
-    glm::vec3 meshSpaceCameraPos(_absTransformInv * glm::vec4(cameraPos, 1.0f));
+    glm::vec3 meshSpaceCameraPos(absoluteTransformInverse() * glm::vec4(cameraPos, 1.0f));
 
     // Return grass clusters in out-of-distance faces, to the pool
     set<int> outOfDistance;
@@ -90,7 +90,7 @@ void GrassSceneNode::update(float dt) {
     for (auto &faceIdx : outOfDistance) {
         auto &clusters = _materializedClusters.find(faceIdx)->second;
         for (auto &cluster : clusters) {
-            _children.erase(cluster);
+            removeChild(*cluster);
             _clusterPool.push(cluster);
         }
         _materializedClusters.erase(faceIdx);
@@ -105,7 +105,7 @@ void GrassSceneNode::update(float dt) {
     multimap<float, int> closestFaces;
     for (size_t faceIdx = 0; faceIdx < faces.size(); ++faceIdx) {
         auto &face = faces[faceIdx];
-        if (_properties.materials.count(face.material) == 0) {
+        if (face.material >= _properties.materials.size() || !_properties.materials[face.material]) {
             continue;
         }
         float distance2 = glm::distance2(face.centroid, meshSpaceCameraPos);
@@ -178,8 +178,8 @@ void MeshSceneNode::draw() {
 
     _graphicsSvc.uniforms.setGeneral([this, &mesh](auto &general) {
         general.resetLocals();
-        general.model = _absTransform;
-        general.modelInv = _absTransformInv;
+        general.model = absoluteTransform();
+        general.modelInv = absoluteTransformInverse();
         general.uv = glm::mat3x4(
             glm::vec4(1.0f, 0.0f, 0.0f, 0.0f),
             glm::vec4(0.0f, 1.0f, 0.0f, 0.0f),
@@ -295,8 +295,8 @@ void MeshSceneNode::drawShadow() {
     }
     _graphicsSvc.uniforms.setGeneral([this](auto &general) {
         general.resetLocals();
-        general.model = _absTransform;
-        general.modelInv = _absTransformInv;
+        general.model = absoluteTransform();
+        general.modelInv = absoluteTransformInverse();
         general.alpha = _alpha;
     });
     _graphicsSvc.shaders.use(_sceneGraph.isShadowLightDirectional() ? _graphicsSvc.shaders.directionalLightShadows() : _graphicsSvc.shaders.pointLightShadows());
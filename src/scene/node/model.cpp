@@ -122,7 +122,7 @@ void ModelSceneNode::drawAABB() {
     _graphicsSvc.context.withPolygonMode(PolygonMode::Line, [this]() {
         _graphicsSvc.uniforms.setGeneral([this](auto &u) {
             u.resetLocals();
-            u.model = _absTransform;
+            u.model = absoluteTransform();
             u.model *= glm::translate(_aabb.center());
             u.model *= glm::scale(0.5f * _aabb.size());
             u.modelInv = glm::inverse(u.model);
@@ -149,10 +149,16 @@ void ModelSceneNode::computeAABB() {
 
     for (auto &attachment : _attachments) {
         if (attachment.second->type() == SceneNodeType::Model) {
-            AABB modelSpaceAABB(attachment.second->aabb() * attachment.second->absoluteTransform() * _absTransformInv);
+            AABB modelSpaceAABB(attachment.second->aabb() * attachment.second->absoluteTransform() * absoluteTransformInverse());
             _aabb.expand(modelSpaceAABB);
         }
     }
+
+    _sceneGraph.invalidateRootBounds(*this);
+}
+
+void ModelSceneNode::onAbsoluteTransformChanged() {
+    _sceneGraph.invalidateRootBounds(*this);
 }
 
 void ModelSceneNode::signalEvent(const string &name) {
@@ -380,6 +386,7 @@ void ModelSceneNode::computeAnimationStates(AnimationChannel &channel, float tim
     if (animNode && modelNode.isAnimated() && doesNodeHaveAncestor(modelNode, channel.anim->root())) {
         AnimationState state;
         state.flags = 0;
+        auto &cursors = channel.cursorsByNodeNumber[modelNode.number()];
 
         glm::vec3 position(modelNode.restPosition());
         glm::quat orientation(modelNode.restOrientation());
@@ -388,7 +395,7 @@ void ModelSceneNode::computeAnimationStates(AnimationChannel &channel, float tim
         if (channel.lipAnim) {
             uint8_t leftShape, rightShape;
             float factor;
-            if (channel.lipAnim->getKeyframes(time, leftShape, rightShape, factor)) {
+            if (channel.lipAnim->getKeyframes(time, leftShape, rightShape, factor, channel.lipCursor)) {
                 glm::vec3 animPosition;
                 if (animNode->getPosition(leftShape, rightShape, factor, animPosition)) {
                     position += channel.properties.scale * animPosition;
@@ -407,17 +414,17 @@ void ModelSceneNode::computeAnimationStates(AnimationChannel &channel, float tim
             }
         } else {
             glm::vec3 animPosition;
-            if (animNode->position().getByTime(time, animPosition)) {
+            if (animNode->position().getByTime(time, animPosition, cursors.position)) {
                 position += channel.properties.scale * animPosition;
                 state.flags |= AnimationStateFlags::transform;
             }
             glm::quat animOrientation;
-            if (animNode->orientation().getByTime(time, animOrientation)) {
+            if (animNode->orientation().getByTime(time, animOrientation, cursors.orientation)) {
                 orientation = move(animOrientation);
                 state.flags |= AnimationStateFlags::transform;
             }
             float animScale;
-            if (animNode->scale().getByTime(time, animScale)) {
+            if (animNode->scale().getByTime(time, animScale, cursors.scale)) {
                 scale = animScale;
                 state.flags |= AnimationStateFlags::transform;
             }
@@ -428,17 +435,17 @@ void ModelSceneNode::computeAnimationStates(AnimationChannel &channel, float tim
             state.transform *= glm::mat4_cast(orientation);
         }
         float animAlpha;
-        if (animNode->alpha().getByTime(time, animAlpha)) {
+        if (animNode->alpha().getByTime(time, animAlpha, cursors.alpha)) {
             state.flags |= AnimationStateFlags::alpha;
             state.alpha = animAlpha;
         }
         glm::vec3 animSelfIllum;
-        if (animNode->selfIllumColor().getByTime(time, animSelfIllum)) {
+        if (animNode->selfIllumColor().getByTime(time, animSelfIllum, cursors.selfIllumColor)) {
             state.flags |= AnimationStateFlags::selfIllumColor;
             state.selfIllumColor = move(animSelfIllum);
         }
         glm::vec3 animColor;
-        if (animNode->color().getByTime(time, animColor)) {
+        if (animNode->color().getByTime(time, animColor, cursors.color)) {
             state.flags |= AnimationStateFlags::color;
             state.color = move(animColor);
         }
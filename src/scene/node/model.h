@@ -64,12 +64,26 @@ public:
         glm::vec3 color {0.0f};
     };
 
+    /**
+     * Indices of keyframes, found by the previous lookups of animated node properties.
+     */
+    struct KeyframeCursors {
+        int position {0};
+        int orientation {0};
+        int scale {0};
+        int alpha {0};
+        int selfIllumColor {0};
+        int color {0};
+    };
+
     struct AnimationChannel {
         graphics::Animation *anim;
         graphics::LipAnimation *lipAnim;
         AnimationProperties properties;
         float time {0.0f};
         std::unordered_map<uint16_t, AnimationState> stateByNodeNumber;
+        std::unordered_map<uint16_t, KeyframeCursors> cursorsByNodeNumber;
+        int lipCursor {0};
         bool freeze {false};     /**< channel time is not to be updated */
         bool transition {false}; /**< when computing states, use animation transition time as channel time */
         bool finished {false};   /**< finished channels will be erased from the queue */
@@ -167,6 +181,8 @@ private:
 
     void buildNodeTree(graphics::ModelNode &node, SceneNode &parent);
 
+    void onAbsoluteTransformChanged() override;
+
     // Animation
 
     void updateAnimations(float dt);
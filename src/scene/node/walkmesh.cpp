@@ -69,7 +69,7 @@ void WalkmeshSceneNode::init() {
 void WalkmeshSceneNode::draw() {
     _graphicsSvc.uniforms.setGeneral([this](auto &general) {
         general.resetLocals();
-        general.model = _absTransform;
+        general.model = absoluteTransform();
     });
     _graphicsSvc.shaders.use(_graphicsSvc.shaders.walkmesh());
     _graphicsSvc.context.withFaceCulling(CullFaceMode::Back, [this]() {
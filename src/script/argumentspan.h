@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "variable.h"
+
+namespace reone {
+
+namespace script {
+
+/**
+ * Non-owning view over routine arguments, as laid out on the execution
+ * stack: the first argument is the topmost variable.
+ */
+class ArgumentSpan {
+public:
+    ArgumentSpan() = default;
+
+    ArgumentSpan(const Variable *bottom, int size) :
+        _bottom(bottom),
+        _size(size) {
+    }
+
+    int size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    const Variable &operator[](int index) const {
+        return _bottom[_size - 1 - index];
+    }
+
+private:
+    const Variable *_bottom {nullptr};
+    int _size {0};
+};
+
+inline bool isOutOfRange(const ArgumentSpan &args, int index) {
+    return index < 0 || index >= args.size();
+}
+
+} // namespace script
+
+} // namespace reone
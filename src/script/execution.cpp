@@ -18,9 +18,12 @@
 #include "execution.h"
 
 #include "../common/logutil.h"
+#include "../common/traceutil.h"
 
+#include "argumentspan.h"
 #include "executioncontext.h"
 #include "instrutil.h"
+#include "profiler.h"
 #include "program.h"
 #include "routine.h"
 #include "routines.h"
@@ -138,66 +141,142 @@ ScriptExecution::ScriptExecution(shared_ptr<ScriptProgram> program, unique_ptr<E
     }
     _handlers.insert(make_pair(InstructionType::NOP, [](auto &) {}));
     _handlers.insert(make_pair(InstructionType::NOP2, [](auto &) {}));
+
+    _insOffset = kStartInstructionOffset;
 }
 
 int ScriptExecution::run() {
-    uint32_t insOff = kStartInstructionOffset;
-
-    if (_context->savedState) {
-        vector<Variable> globals(_context->savedState->globals);
-        copy(globals.begin(), globals.end(), back_inserter(_stack));
-        _globalCount = static_cast<int>(_stack.size());
+    runSlice(0);
+    return _result;
+}
 
-        vector<Variable> locals(_context->savedState->locals);
-        copy(locals.begin(), locals.end(), back_inserter(_stack));
+bool ScriptExecution::runSlice(int budget) {
+    R_TRACE_ZONE("ScriptExecution::runSlice");
 
-        insOff = _context->savedState->insOffset;
+    if (_finished) {
+        return true;
+    }
+    if (!_started) {
+        start();
     }
 
-    debug(boost::format("Run '%s': offset=%04x, caller=%u, triggerrer=%u") %
-              _program->name() %
-              insOff %
-              _context->callerId %
-              _context->triggererId,
-          LogChannels::script);
-
-    while (insOff < _program->length()) {
-        const Instruction &ins = _program->getInstruction(insOff);
-        auto handler = _handlers.find(ins.type);
+    auto startTime = chrono::steady_clock::now();
+    int executed = 0;
+    bool halted = false;
 
-        if (handler == _handlers.end()) {
-            error(boost::format("Instruction not implemented: %04x") % static_cast<int>(ins.type), LogChannels::script);
-            return -1;
+    while (_insOffset < _program->length()) {
+        if (budget > 0 && executed >= budget) {
+            break;
         }
-        _nextInstruction = ins.nextOffset;
-
-        if (isLogChannelEnabled(LogChannels::script3)) {
-            debug(boost::format("Instruction: %s") % describeInstruction(ins, *_context->routines), LogChannels::script3);
+        const Instruction &ins = _program->getInstruction(_insOffset);
+        int insCount = max(1, ins.superCount);
+        _nextInstruction = (&ins)[insCount - 1].nextOffset;
+        executed += insCount;
+
+        if (isLogEnabled(LogLevel::Debug, LogChannels::script3)) {
+            for (int i = 0; i < insCount; ++i) {
+                debug(boost::format("Instruction: %s") % describeInstruction((&ins)[i], *_context->routines), LogChannels::script3);
+            }
         }
         try {
-            handler->second(ins);
+            if (ins.superType != SuperInstructionType::None) {
+                executeSuperInstruction(ins);
+            } else {
+                auto handler = _handlers.find(ins.type);
+                if (handler == _handlers.end()) {
+                    error(boost::format("Instruction not implemented: %04x") % static_cast<int>(ins.type), LogChannels::script);
+                    halted = true;
+                    break;
+                }
+                handler->second(ins);
+            }
         } catch (const exception &ex) {
-            debug(boost::format("Halt '%s'") % _program->name(), LogChannels::script);
-            return -1;
+            R_DEBUG(boost::format("Halt '%s'") % _program->name(), LogChannels::script);
+            halted = true;
+            break;
+        }
+
+        _insOffset = _nextInstruction;
+    }
+
+    _instructionsExecuted += executed;
+    _timeNanos += chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - startTime).count();
+
+    if (!halted && _insOffset < _program->length()) {
+        R_DEBUG(boost::format("Suspend '%s': offset=%04x") % _program->name() % _insOffset, LogChannels::script);
+        return false;
+    }
+    if (!halted && stackSize() > 0) {
+        const Variable &top = stackAt(stackSize() - 1);
+        if (top.type == VariableType::Int) {
+            _result = top.intValue;
         }
+    }
+    _finished = true;
 
-        insOff = _nextInstruction;
+    if (_context->profiler) {
+        _context->profiler->recordRun(_program->name(), _instructionsExecuted, _timeNanos);
     }
 
-    if (!_stack.empty() && _stack.back().type == VariableType::Int) {
-        return _stack.back().intValue;
+    return true;
+}
+
+void ScriptExecution::reset(shared_ptr<ScriptProgram> program, unique_ptr<ExecutionContext> context) {
+    _program = move(program);
+    _context = move(context);
+
+    // Keep allocated capacity for reuse
+    _stack.clear();
+    _args.clear();
+    _returnOffsets.clear();
+
+    _nextInstruction = 0;
+    _globalCount = 0;
+    _savedState.reset();
+    _sharedGlobals.reset();
+    _globalsSnapshot.reset();
+    _stackBase = 0;
+
+    _insOffset = kStartInstructionOffset;
+    _started = false;
+    _finished = false;
+    _result = -1;
+    _instructionsExecuted = 0;
+    _timeNanos = 0;
+}
+
+void ScriptExecution::start() {
+    if (_context->savedState) {
+        // Globals are read from the saved state until written to
+        _sharedGlobals = _context->savedState->globals;
+        _globalsSnapshot = _sharedGlobals;
+        _stackBase = static_cast<int>(_sharedGlobals->size());
+        _globalCount = _stackBase;
+
+        auto &locals = *_context->savedState->locals;
+        _stack.insert(_stack.end(), locals.begin(), locals.end());
+
+        _insOffset = _context->savedState->insOffset;
     }
 
-    return -1;
+    R_DEBUG(boost::format("Run '%s': offset=%04x, caller=%u, triggerrer=%u") %
+                _program->name() %
+                _insOffset %
+                _context->callerId %
+                _context->triggererId,
+            LogChannels::script);
+
+    _started = true;
 }
 
 void ScriptExecution::executeCPDOWNSP(const Instruction &ins) {
     int count = ins.size / 4;
-    int srcIdx = static_cast<int>(_stack.size()) - count;
-    int dstIdx = static_cast<int>(_stack.size()) + ins.stackOffset / 4;
+    int srcIdx = stackSize() - count;
+    int dstIdx = stackSize() + ins.stackOffset / 4;
 
     for (int i = 0; i < count; ++i) {
-        _stack[dstIdx++] = _stack[srcIdx++];
+        Variable &dst = mutableStackAt(dstIdx++);
+        dst = stackAt(srcIdx++);
     }
 }
 
@@ -235,10 +314,10 @@ void ScriptExecution::executeRSADDTAL(const Instruction &ins) {
 
 void ScriptExecution::executeCPTOPSP(const Instruction &ins) {
     int count = ins.size / 4;
-    int srcIdx = static_cast<int>(_stack.size()) + ins.stackOffset / 4;
+    int srcIdx = stackSize() + ins.stackOffset / 4;
 
     for (int i = 0; i < count; ++i) {
-        _stack.push_back(_stack[srcIdx++]);
+        _stack.push_back(stackAt(srcIdx++));
     }
 }
 
@@ -265,40 +344,96 @@ void ScriptExecution::executeACTION(const Instruction &ins) {
         throw runtime_error("Too many routine arguments");
     }
 
-    vector<Variable> args;
+    // Plain arguments occupy one stack slot each and are passed to the routine
+    // directly from the top of the stack. Vectors (three slots) and actions
+    // (no slots) must first be normalized into a reusable argument buffer.
+    bool normalize = false;
+    int numSlots = 0;
     for (int i = 0; i < ins.argCount; ++i) {
         VariableType type = routine.getArgumentType(i);
         switch (type) {
         case VariableType::Vector:
-            args.push_back(Variable::ofVector(getVectorFromStack()));
+            normalize = true;
+            numSlots += 3;
             break;
-
-        case VariableType::Action: {
-            auto ctx = make_shared<ExecutionContext>(*_context);
-            ctx->savedState = make_shared<ExecutionState>(_savedState);
-            args.push_back(Variable::ofAction(move(ctx)));
+        case VariableType::Action:
+            normalize = true;
             break;
-        }
         default:
-            Variable var(_stack.back());
-            if (var.type != type) {
+            ++numSlots;
+            break;
+        }
+    }
+    if (numSlots > stackSize()) {
+        throw runtime_error("Not enough routine arguments on stack");
+    }
+    if (numSlots > static_cast<int>(_stack.size())) {
+        unshareGlobals();
+    }
+    int argsIdx = static_cast<int>(_stack.size()) - numSlots;
+
+    ArgumentSpan args;
+    if (normalize) {
+        _args.resize(ins.argCount);
+        int srcIdx = static_cast<int>(_stack.size());
+        for (int i = 0; i < ins.argCount; ++i) {
+            VariableType type = routine.getArgumentType(i);
+            Variable &arg = _args[ins.argCount - 1 - i];
+            switch (type) {
+            case VariableType::Vector: {
+                srcIdx -= 3;
+                for (int j = 0; j < 3; ++j) {
+                    throwIfInvalidType(VariableType::Float, _stack[srcIdx + j].type);
+                }
+                arg = Variable::ofVector(glm::vec3(_stack[srcIdx].floatValue, _stack[srcIdx + 1].floatValue, _stack[srcIdx + 2].floatValue));
+                break;
+            }
+            case VariableType::Action: {
+                auto ctx = make_shared<ExecutionContext>(*_context);
+                ctx->savedState = _savedState;
+                arg = Variable::ofAction(move(ctx));
+                break;
+            }
+            default:
+                --srcIdx;
+                if (_stack[srcIdx].type != type) {
+                    throw runtime_error("Invalid argument variable type");
+                }
+                arg = move(_stack[srcIdx]);
+                break;
+            }
+        }
+        args = ArgumentSpan(_args.data(), ins.argCount);
+    } else {
+        for (int i = 0; i < ins.argCount; ++i) {
+            if (_stack[_stack.size() - 1 - i].type != routine.getArgumentType(i)) {
                 throw runtime_error("Invalid argument variable type");
             }
-            args.push_back(move(var));
-            _stack.pop_back();
-            break;
         }
+        args = ArgumentSpan(_stack.data() + argsIdx, ins.argCount);
     }
 
-    Variable retValue = routine.invoke(args, *_context);
-    if (isLogChannelEnabled(LogChannels::script2)) {
+    Variable retValue;
+    if (_context->profiler) {
+        auto startTime = chrono::steady_clock::now();
+        retValue = routine.invoke(args, *_context);
+        auto time = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - startTime);
+        _context->profiler->recordRoutineCall(routine.name(), time.count());
+    } else {
+        retValue = routine.invoke(args, *_context);
+    }
+    if (isLogEnabled(LogLevel::Debug, LogChannels::script2)) {
         vector<string> argStrings;
-        for (auto &arg : args) {
-            argStrings.push_back(arg.toString());
+        for (int i = 0; i < args.size(); ++i) {
+            argStrings.push_back(args[i].toString());
         }
         string argsString(boost::join(argStrings, ", "));
         debug(boost::format("Action: %04x %s(%s) -> %s") % ins.offset % routine.name() % argsString % retValue.toString(), LogChannels::script2);
     }
+
+    // Arguments are consumed, return value takes their place on the stack
+    truncateStack(_stackBase + argsIdx);
+    _args.clear();
     switch (routine.returnType()) {
     case VariableType::Void:
         break;
@@ -308,7 +443,7 @@ void ScriptExecution::executeACTION(const Instruction &ins) {
         _stack.push_back(Variable::ofFloat(retValue.vecValue.x));
         break;
     default:
-        _stack.push_back(retValue);
+        _stack.push_back(move(retValue));
         break;
     }
 }
@@ -371,13 +506,11 @@ void ScriptExecution::executeEQUALTT(const Instruction &ins) {
     int numVariables = ins.size / 4;
     vector<Variable> vars1;
     for (int i = 0; i < numVariables; ++i) {
-        vars1.push_back(move(_stack.back()));
-        _stack.pop_back();
+        vars1.push_back(popStack());
     }
     vector<Variable> vars2;
     for (int i = 0; i < numVariables; ++i) {
-        vars2.push_back(move(_stack.back()));
-        _stack.pop_back();
+        vars2.push_back(popStack());
     }
     bool equal = std::equal(vars1.begin(), vars1.end(), vars2.begin());
     _stack.push_back(Variable::ofInt(static_cast<int>(equal)));
@@ -435,13 +568,11 @@ void ScriptExecution::executeNEQUALTT(const Instruction &ins) {
     int numVariables = ins.size / 4;
     vector<Variable> vars1;
     for (int i = 0; i < numVariables; ++i) {
-        vars1.push_back(move(_stack.back()));
-        _stack.pop_back();
+        vars1.push_back(popStack());
     }
     vector<Variable> vars2;
     for (int i = 0; i < numVariables; ++i) {
-        vars2.push_back(move(_stack.back()));
-        _stack.pop_back();
+        vars2.push_back(popStack());
     }
     bool notEqual = !std::equal(vars1.begin(), vars1.end(), vars2.begin());
     _stack.push_back(Variable::ofInt(static_cast<int>(notEqual)));
@@ -706,18 +837,15 @@ void ScriptExecution::executeMODII(const Instruction &ins) {
 }
 
 void ScriptExecution::executeNEGI(const Instruction &ins) {
-    _stack.back().intValue *= -1;
+    mutableStackAt(stackSize() - 1).intValue *= -1;
 }
 
 void ScriptExecution::executeNEGF(const Instruction &ins) {
-    _stack.back().floatValue *= -1.0f;
+    mutableStackAt(stackSize() - 1).floatValue *= -1.0f;
 }
 
 void ScriptExecution::executeMOVSP(const Instruction &ins) {
-    int count = -ins.stackOffset / 4;
-    for (int i = 0; i < count; ++i) {
-        _stack.pop_back();
-    }
+    truncateStack(stackSize() + ins.stackOffset / 4);
 }
 
 void ScriptExecution::executeJMP(const Instruction &ins) {
@@ -746,24 +874,25 @@ void ScriptExecution::executeRETN(const Instruction &ins) {
 }
 
 void ScriptExecution::executeDESTRUCT(const Instruction &ins) {
-    int startIdx = static_cast<int>(_stack.size()) - ins.size / 4;
+    int startIdx = stackSize() - ins.size / 4;
     int startIdxNoDestroy = startIdx + ins.stackOffset / 4;
     int countNoDestroy = ins.sizeNoDestroy / 4;
 
     for (int i = 0; i < countNoDestroy; ++i) {
-        _stack[startIdx + i] = _stack[startIdxNoDestroy + i];
+        Variable &dst = mutableStackAt(startIdx + i);
+        dst = stackAt(startIdxNoDestroy + i);
     }
-    _stack.resize(startIdx + countNoDestroy);
+    truncateStack(startIdx + countNoDestroy);
 }
 
 void ScriptExecution::executeDECISP(const Instruction &ins) {
-    int dstIdx = static_cast<int>(_stack.size()) + ins.stackOffset / 4;
-    _stack[dstIdx].intValue--;
+    int dstIdx = stackSize() + ins.stackOffset / 4;
+    mutableStackAt(dstIdx).intValue--;
 }
 
 void ScriptExecution::executeINCISP(const Instruction &ins) {
-    int dstIdx = static_cast<int>(_stack.size()) + ins.stackOffset / 4;
-    _stack[dstIdx].intValue++;
+    int dstIdx = stackSize() + ins.stackOffset / 4;
+    mutableStackAt(dstIdx).intValue++;
 }
 
 void ScriptExecution::executeNOTI(const Instruction &ins) {
@@ -780,11 +909,12 @@ void ScriptExecution::executeJNZ(const Instruction &ins) {
 
 void ScriptExecution::executeCPDOWNBP(const Instruction &ins) {
     int count = ins.size / 4;
-    int srcIdx = static_cast<int>(_stack.size()) - count;
+    int srcIdx = stackSize() - count;
     int dstIdx = _globalCount + ins.stackOffset / 4;
 
     for (int i = 0; i < count; ++i) {
-        _stack[dstIdx++] = _stack[srcIdx++];
+        Variable &dst = mutableStackAt(dstIdx++);
+        dst = stackAt(srcIdx++);
     }
 }
 
@@ -793,53 +923,129 @@ void ScriptExecution::executeCPTOPBP(const Instruction &ins) {
     int srcIdx = _globalCount + ins.stackOffset / 4;
 
     for (int i = 0; i < count; ++i) {
-        _stack.push_back(_stack[srcIdx++]);
+        _stack.push_back(stackAt(srcIdx++));
     }
 }
 
 void ScriptExecution::executeDECIBP(const Instruction &ins) {
     int dstIdx = _globalCount + ins.stackOffset / 4;
-    _stack[dstIdx].intValue--;
+    mutableStackAt(dstIdx).intValue--;
 }
 
 void ScriptExecution::executeINCIBP(const Instruction &ins) {
     int dstIdx = _globalCount + ins.stackOffset / 4;
-    _stack[dstIdx].intValue++;
+    mutableStackAt(dstIdx).intValue++;
 }
 
 void ScriptExecution::executeSAVEBP(const Instruction &ins) {
-    _globalCount = static_cast<int>(_stack.size());
+    _globalCount = stackSize();
+    _globalsSnapshot.reset();
     _stack.push_back(Variable::ofInt(_globalCount));
 }
 
 void ScriptExecution::executeRESTOREBP(const Instruction &ins) {
     _globalCount = getIntFromStack();
+    _globalsSnapshot.reset();
 }
 
 void ScriptExecution::executeSTORE_STATE(const Instruction &ins) {
-    int count = ins.size / 4;
-    int srcIdx = _globalCount - count;
+    int count = ins.sizeLocals / 4;
+    int srcIdx = stackSize() - count;
 
-    _savedState.globals.clear();
+    auto locals = make_shared<vector<Variable>>();
+    locals->reserve(count);
     for (int i = 0; i < count; ++i) {
-        _savedState.globals.push_back(_stack[srcIdx++]);
+        locals->push_back(stackAt(srcIdx++));
     }
 
-    count = ins.sizeLocals / 4;
-    srcIdx = static_cast<int>(_stack.size()) - count;
-
-    _savedState.locals.clear();
-    for (int i = 0; i < count; ++i) {
-        _savedState.locals.push_back(_stack[srcIdx++]);
+    // Saved states are immutable and may be shared by any number of actions
+    auto state = make_shared<ExecutionState>();
+    state->program = _program;
+    state->globals = snapshotGlobals(ins.size / 4);
+    state->locals = move(locals);
+    state->insOffset = ins.offset + 0x10;
+    _savedState = move(state);
+}
+
+void ScriptExecution::executeSuperInstruction(const Instruction &ins) {
+    // Instructions of a fused sequence are stored contiguously
+    const Instruction *seq = &ins;
+
+    switch (ins.superType) {
+    case SuperInstructionType::CPTOPSP_CONSTI_EQUALII_JZ: {
+        const Variable &var = stackAt(stackSize() + seq[0].stackOffset / 4);
+        throwIfInvalidType(VariableType::Int, var.type);
+        if (var.intValue != seq[1].intValue) {
+            _nextInstruction = seq[3].offset + seq[3].jumpOffset;
+        }
+        break;
     }
+    case SuperInstructionType::RSADDx_CPDOWNSP_MOVSP:
+        switch (seq[0].type) {
+        case InstructionType::RSADDI:
+            _stack.push_back(Variable::ofInt(0));
+            break;
+        case InstructionType::RSADDF:
+            _stack.push_back(Variable::ofFloat(0.0f));
+            break;
+        case InstructionType::RSADDS:
+            _stack.push_back(Variable::ofString(""));
+            break;
+        case InstructionType::RSADDO:
+            _stack.push_back(Variable::ofObject(kObjectInvalid));
+            break;
+        case InstructionType::RSADDEFF:
+            _stack.push_back(Variable::ofEffect(nullptr));
+            break;
+        case InstructionType::RSADDEVT:
+            _stack.push_back(Variable::ofEvent(nullptr));
+            break;
+        case InstructionType::RSADDLOC:
+            _stack.push_back(Variable::ofLocation(nullptr));
+            break;
+        case InstructionType::RSADDTAL:
+            _stack.push_back(Variable::ofTalent(nullptr));
+            break;
+        default:
+            throw logic_error("Unexpected instruction type: " + to_string(static_cast<int>(seq[0].type)));
+        }
+        executeCPDOWNSP_MOVSP(seq[1], seq[2]);
+        break;
+    case SuperInstructionType::CPDOWNSP_MOVSP:
+        executeCPDOWNSP_MOVSP(seq[0], seq[1]);
+        break;
+    default:
+        throw logic_error("Unsupported superinstruction type: " + to_string(static_cast<int>(ins.superType)));
+    }
+}
 
-    _savedState.program = _program;
-    _savedState.insOffset = ins.offset + 0x10;
+void ScriptExecution::executeCPDOWNSP_MOVSP(const Instruction &cpdownsp, const Instruction &movsp) {
+    int count = cpdownsp.size / 4;
+    int srcIdx = stackSize() - count;
+    int dstIdx = stackSize() + cpdownsp.stackOffset / 4;
+    int popCount = -movsp.stackOffset / 4;
+
+    // Source variables that are about to be popped can be moved instead of copied
+    bool moveSources = popCount >= count;
+    if (moveSources && srcIdx < _stackBase) {
+        unshareGlobals();
+    }
+    for (int i = 0; i < count; ++i, ++srcIdx, ++dstIdx) {
+        if (srcIdx == dstIdx) {
+            continue;
+        }
+        Variable &dst = mutableStackAt(dstIdx);
+        if (moveSources) {
+            dst = move(_stack[srcIdx - _stackBase]);
+        } else {
+            dst = stackAt(srcIdx);
+        }
+    }
+    truncateStack(stackSize() - popCount);
 }
 
 int ScriptExecution::getIntFromStack() {
-    Variable var(move(_stack.back()));
-    _stack.pop_back();
+    Variable var(popStack());
 
     throwIfInvalidType(VariableType::Int, var.type);
 
@@ -847,8 +1053,7 @@ int ScriptExecution::getIntFromStack() {
 }
 
 float ScriptExecution::getFloatFromStack() {
-    Variable var(move(_stack.back()));
-    _stack.pop_back();
+    Variable var(popStack());
 
     throwIfInvalidType(VariableType::Float, var.type);
 
@@ -864,11 +1069,8 @@ glm::vec3 ScriptExecution::getVectorFromStack() {
 }
 
 void ScriptExecution::withStackVariables(const function<void(const Variable &, const Variable &)> &fn) {
-    Variable second(move(_stack.back()));
-    _stack.pop_back();
-
-    Variable first(move(_stack.back()));
-    _stack.pop_back();
+    Variable second(popStack());
+    Variable first(popStack());
 
     fn(first, second);
 }
@@ -982,12 +1184,72 @@ void ScriptExecution::throwIfInvalidType(VariableType expected, VariableType act
     }
 }
 
+Variable &ScriptExecution::mutableStackAt(int index) {
+    if (index < _globalCount) {
+        _globalsSnapshot.reset();
+    }
+    if (index < _stackBase) {
+        unshareGlobals();
+    }
+    return _stack[index - _stackBase];
+}
+
+Variable ScriptExecution::popStack() {
+    if (stackSize() <= _globalCount) {
+        _globalsSnapshot.reset();
+    }
+    if (_stack.empty()) {
+        unshareGlobals();
+        if (_stack.empty()) {
+            throw runtime_error("Stack underflow");
+        }
+    }
+    Variable var(move(_stack.back()));
+    _stack.pop_back();
+
+    return move(var);
+}
+
+void ScriptExecution::truncateStack(int size) {
+    if (size < _globalCount) {
+        _globalsSnapshot.reset();
+    }
+    if (size < _stackBase) {
+        unshareGlobals();
+    }
+    _stack.resize(size - _stackBase);
+}
+
+void ScriptExecution::unshareGlobals() {
+    if (!_sharedGlobals) {
+        return;
+    }
+    _stack.insert(_stack.begin(), _sharedGlobals->begin(), _sharedGlobals->end());
+    _sharedGlobals.reset();
+    _stackBase = 0;
+}
+
+shared_ptr<const vector<Variable>> ScriptExecution::snapshotGlobals(int count) {
+    // Globals that were not written to since the last snapshot are shared
+    if (_globalsSnapshot && static_cast<int>(_globalsSnapshot->size()) == count) {
+        return _globalsSnapshot;
+    }
+    auto globals = make_shared<vector<Variable>>();
+    globals->reserve(count);
+    for (int i = _globalCount - count; i < _globalCount; ++i) {
+        globals->push_back(stackAt(i));
+    }
+    _globalsSnapshot = move(globals);
+
+    return _globalsSnapshot;
+}
+
 int ScriptExecution::getStackSize() const {
-    return static_cast<int>(_stack.size());
+    return stackSize();
 }
 
 const Variable &ScriptExecution::getStackVariable(int index) const {
-    return _stack[index];
+    return stackAt(index);
 }
 
 } // namespace script
@@ -36,8 +36,32 @@ class ScriptExecution : boost::noncopyable {
 public:
     ScriptExecution(std::shared_ptr<ScriptProgram> program, std::unique_ptr<ExecutionContext> context);
 
+    /**
+     * Runs this execution until completion.
+     *
+     * @return script result, or -1 if script did not return an integer
+     */
     int run();
 
+    /**
+     * Runs this execution until completion, or until the instruction budget
+     * is exhausted, in which case subsequent calls resume execution.
+     *
+     * @param budget maximum number of instructions to execute, 0 is unlimited
+     * @return `true` if execution is finished, `false` if suspended
+     */
+    bool runSlice(int budget);
+
+    /**
+     * Prepares this execution for reuse with another program.
+     */
+    void reset(std::shared_ptr<ScriptProgram> program, std::unique_ptr<ExecutionContext> context);
+
+    bool isFinished() const { return _finished; }
+
+    int result() const { return _result; }
+    int64_t instructionsExecuted() const { return _instructionsExecuted; }
+
     void stackPush(Variable var) {
         _stack.push_back(std::move(var));
     }
@@ -50,10 +74,22 @@ private:
     std::unique_ptr<ExecutionContext> _context;
     std::unordered_map<InstructionType, std::function<void(const Instruction &)>> _handlers;
     std::vector<Variable> _stack;
+    std::vector<Variable> _args;
     std::vector<uint32_t> _returnOffsets;
     uint32_t _nextInstruction {0};
     int _globalCount {0};
-    ExecutionState _savedState;
+    std::shared_ptr<ExecutionState> _savedState;
+
+    std::shared_ptr<const std::vector<Variable>> _sharedGlobals;   /**< globals of a resumed state, not yet copied onto the stack */
+    std::shared_ptr<const std::vector<Variable>> _globalsSnapshot; /**< last stored globals, reset when globals are written to */
+    int _stackBase {0};                                            /**< number of bottom stack slots held by _sharedGlobals */
+
+    uint32_t _insOffset {0};
+    bool _started {false};
+    bool _finished {false};
+    int _result {-1};
+    int64_t _instructionsExecuted {0};
+    int64_t _timeNanos {0};
 
     void registerHandler(InstructionType type, std::function<void(ScriptExecution *, const Instruction &)> handler) {
         _handlers.insert(std::make_pair(type, std::bind(handler, this, std::placeholders::_1)));
@@ -79,8 +115,30 @@ private:
     void withVectorFloatFromStack(const std::function<void(const glm::vec3 &, float)> &fn);
     void withVectorsFromStack(const std::function<void(const glm::vec3 &, const glm::vec3 &)> &fn);
 
+    void start();
+
     void throwIfInvalidType(VariableType expected, VariableType actual);
 
+    // Stack access
+
+    int stackSize() const {
+        return _stackBase + static_cast<int>(_stack.size());
+    }
+
+    const Variable &stackAt(int index) const {
+        return index < _stackBase ? (*_sharedGlobals)[index] : _stack[index - _stackBase];
+    }
+
+    Variable &mutableStackAt(int index);
+    Variable popStack();
+
+    void truncateStack(int size);
+    void unshareGlobals();
+
+    std::shared_ptr<const std::vector<Variable>> snapshotGlobals(int count);
+
+    // END Stack access
+
     // Handlers
 
     R_INSTR_HANDLER(CPDOWNSP)
@@ -177,6 +235,13 @@ private:
     R_INSTR_HANDLER(STORE_STATE)
 
     // END Handlers
+
+    // Superinstructions
+
+    void executeSuperInstruction(const Instruction &ins);
+    void executeCPDOWNSP_MOVSP(const Instruction &cpdownsp, const Instruction &movsp);
+
+    // END Superinstructions
 };
 
 } // namespace script
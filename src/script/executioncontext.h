@@ -26,9 +26,11 @@ namespace script {
 struct ExecutionState;
 
 class IRoutines;
+class ScriptProfiler;
 
 struct ExecutionContext {
     IRoutines *routines {nullptr};
+    ScriptProfiler *profiler {nullptr};
     std::shared_ptr<ExecutionState> savedState;
     uint32_t callerId {kObjectInvalid};
     uint32_t triggererId {kObjectInvalid};
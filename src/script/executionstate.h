@@ -25,10 +25,15 @@ namespace script {
 
 class ScriptProgram;
 
+/**
+ * Immutable snapshot of a script execution, produced by STORE_STATE. Globals
+ * and locals are shared between saved states and resumed executions, and are
+ * only copied when a resumed execution writes to them.
+ */
 struct ExecutionState {
     std::shared_ptr<ScriptProgram> program;
-    std::vector<Variable> globals;
-    std::vector<Variable> locals;
+    std::shared_ptr<const std::vector<Variable>> globals;
+    std::shared_ptr<const std::vector<Variable>> locals;
     uint32_t insOffset {0};
 };
 
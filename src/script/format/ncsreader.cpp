@@ -17,6 +17,7 @@
 
 #include "ncsreader.h"
 
+#include "../../common/exception/validation.h"
 #include "../../common/logutil.h"
 
 #include "../program.h"
@@ -27,25 +28,66 @@ namespace reone {
 
 namespace script {
 
+static constexpr size_t kHeaderSize = 13;
+
+static inline uint16_t loadUint16(const uint8_t *data) {
+    return static_cast<uint16_t>((data[0] << 8) | data[1]);
+}
+
+static inline uint32_t loadUint32(const uint8_t *data) {
+    return (static_cast<uint32_t>(data[0]) << 24) |
+           (static_cast<uint32_t>(data[1]) << 16) |
+           (static_cast<uint32_t>(data[2]) << 8) |
+           static_cast<uint32_t>(data[3]);
+}
+
+static inline int16_t loadInt16(const uint8_t *data) {
+    return static_cast<int16_t>(loadUint16(data));
+}
+
+static inline int32_t loadInt32(const uint8_t *data) {
+    return static_cast<int32_t>(loadUint32(data));
+}
+
+static inline float loadFloat(const uint8_t *data) {
+    uint32_t bits = loadUint32(data);
+    float result;
+    memcpy(&result, &bits, sizeof(float));
+    return result;
+}
+
 void NcsReader::onLoad() {
     checkSignature(string("NCS V1.0", 8));
 
-    uint8_t byteCode = readByte();
-    uint32_t length = readUint32();
+    if (_size < kHeaderSize) {
+        throw ValidationException("Invalid NCS header");
+    }
+
+    // Decode instructions from a single buffer, bypassing per-value stream reads
+    auto buffer = readBytes(0, static_cast<int>(_size));
+    auto data = reinterpret_cast<const uint8_t *>(&buffer[0]);
+    size_t length = min(static_cast<size_t>(loadUint32(&data[9])), _size);
 
-    _program = make_unique<ScriptProgram>(_resRef);
+    _program = make_shared<ScriptProgram>(_resRef);
 
-    size_t off = tell();
-    while (off < length) {
-        readInstruction(off);
+    size_t offset = kHeaderSize;
+    while (offset < length) {
+        offset = readInstruction(data, offset, length);
     }
 }
 
-void NcsReader::readInstruction(size_t &offset) {
-    seek(offset);
+size_t NcsReader::readInstruction(const uint8_t *data, size_t offset, size_t length) {
+    auto checkOperands = [&](size_t size) {
+        if (offset + 2 + size > length) {
+            throw ValidationException(str(boost::format("NCS instruction out of bounds: %u") % offset));
+        }
+    };
+    checkOperands(0);
 
-    uint8_t byteCode = readByte();
-    uint8_t qualifier = readByte();
+    uint8_t byteCode = data[offset];
+    uint8_t qualifier = data[offset + 1];
+    const uint8_t *operands = &data[offset + 2];
+    size_t operandsSize = 0;
 
     Instruction ins;
     ins.offset = static_cast<uint32_t>(offset);
@@ -56,54 +98,68 @@ void NcsReader::readInstruction(size_t &offset) {
     case InstructionType::CPTOPSP:
     case InstructionType::CPDOWNBP:
     case InstructionType::CPTOPBP:
-        ins.stackOffset = readInt32();
-        ins.size = readUint16();
+        checkOperands(operandsSize = 6);
+        ins.stackOffset = loadInt32(&operands[0]);
+        ins.size = loadUint16(&operands[4]);
         break;
     case InstructionType::CONSTI:
-        ins.intValue = readInt32();
+        checkOperands(operandsSize = 4);
+        ins.intValue = loadInt32(operands);
         break;
     case InstructionType::CONSTF:
-        ins.floatValue = readFloat();
+        checkOperands(operandsSize = 4);
+        ins.floatValue = loadFloat(operands);
         break;
     case InstructionType::CONSTS: {
-        uint16_t len = readUint16();
-        ins.strValue = readCString(len);
+        checkOperands(2);
+        uint16_t len = loadUint16(operands);
+        checkOperands(operandsSize = 2 + len);
+        auto str = reinterpret_cast<const char *>(&operands[2]);
+        ins.strValue = string(str, find(str, str + len, '\0'));
         break;
     }
     case InstructionType::CONSTO:
-        ins.objectId = readInt32();
+        checkOperands(operandsSize = 4);
+        ins.objectId = loadInt32(operands);
         break;
     case InstructionType::ACTION:
-        ins.routine = readUint16();
-        ins.argCount = readByte();
+        checkOperands(operandsSize = 3);
+        ins.routine = loadUint16(&operands[0]);
+        ins.argCount = operands[2];
         break;
     case InstructionType::MOVSP:
-        ins.stackOffset = readInt32();
+        checkOperands(operandsSize = 4);
+        ins.stackOffset = loadInt32(operands);
         break;
     case InstructionType::JMP:
     case InstructionType::JSR:
     case InstructionType::JZ:
     case InstructionType::JNZ:
-        ins.jumpOffset = readInt32();
+        checkOperands(operandsSize = 4);
+        ins.jumpOffset = loadInt32(operands);
         break;
     case InstructionType::DESTRUCT:
-        ins.size = readUint16();
-        ins.stackOffset = readInt16();
-        ins.sizeNoDestroy = readUint16();
+        checkOperands(operandsSize = 6);
+        ins.size = loadUint16(&operands[0]);
+        ins.stackOffset = loadInt16(&operands[2]);
+        ins.sizeNoDestroy = loadUint16(&operands[4]);
         break;
     case InstructionType::DECISP:
     case InstructionType::INCISP:
     case InstructionType::DECIBP:
     case InstructionType::INCIBP:
-        ins.stackOffset = readInt32();
+        checkOperands(operandsSize = 4);
+        ins.stackOffset = loadInt32(operands);
         break;
     case InstructionType::STORE_STATE:
-        ins.size = readUint32();
-        ins.sizeLocals = readUint32();
+        checkOperands(operandsSize = 8);
+        ins.size = loadUint32(&operands[0]);
+        ins.sizeLocals = loadUint32(&operands[4]);
         break;
     case InstructionType::EQUALTT:
     case InstructionType::NEQUALTT:
-        ins.size = readUint16();
+        checkOperands(operandsSize = 2);
+        ins.size = loadUint16(operands);
         break;
     case InstructionType::NOP:
     case InstructionType::RSADDI:
@@ -183,12 +239,12 @@ void NcsReader::readInstruction(size_t &offset) {
         throw runtime_error(str(boost::format("Unsupported instruction type: %04x") % static_cast<int>(ins.type)));
     }
 
-    size_t pos = tell();
-    ins.nextOffset = static_cast<uint32_t>(pos);
+    size_t nextOffset = offset + 2 + operandsSize;
+    ins.nextOffset = static_cast<uint32_t>(nextOffset);
 
     _program->add(move(ins));
 
-    offset = pos;
+    return nextOffset;
 }
 
 } // namespace script
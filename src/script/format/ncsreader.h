@@ -45,7 +45,7 @@ private:
     std::string _resRef;
     std::shared_ptr<ScriptProgram> _program;
 
-    void readInstruction(size_t &offset);
+    size_t readInstruction(const uint8_t *data, size_t offset, size_t length);
 };
 
 } // namespace script
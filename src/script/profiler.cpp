@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "profiler.h"
+
+#include "../common/stream/output.h"
+#include "../common/textwriter.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace script {
+
+template <class T>
+static vector<pair<string, T>> sortByTime(const unordered_map<string, T> &stats) {
+    vector<pair<string, T>> sorted(stats.begin(), stats.end());
+    sort(sorted.begin(), sorted.end(), [](auto &left, auto &right) {
+        return left.second.timeNanos > right.second.timeNanos;
+    });
+    return move(sorted);
+}
+
+void ScriptProfiler::recordRun(const string &script, int64_t instructions, int64_t timeNanos) {
+    auto &stats = _scriptStats[script];
+    ++stats.runs;
+    stats.instructions += instructions;
+    stats.timeNanos += timeNanos;
+}
+
+void ScriptProfiler::recordRoutineCall(const string &routine, int64_t timeNanos) {
+    auto &stats = _routineStats[routine];
+    ++stats.calls;
+    stats.timeNanos += timeNanos;
+}
+
+void ScriptProfiler::save(IOutputStream &stream) const {
+    TextWriter writer(stream);
+
+    writer.putLine("kind,name,count,instructions,total_ms,avg_us");
+    for (auto &pair : sortByTime(_scriptStats)) {
+        auto &stats = pair.second;
+        writer.putLine(str(boost::format("script,%s,%d,%d,%.3f,%.3f") %
+                           pair.first %
+                           stats.runs %
+                           stats.instructions %
+                           (stats.timeNanos / 1e6) %
+                           (stats.timeNanos / 1e3 / stats.runs)));
+    }
+    for (auto &pair : sortByTime(_routineStats)) {
+        auto &stats = pair.second;
+        writer.putLine(str(boost::format("routine,%s,%d,,%.3f,%.3f") %
+                           pair.first %
+                           stats.calls %
+                           (stats.timeNanos / 1e6) %
+                           (stats.timeNanos / 1e3 / stats.calls)));
+    }
+}
+
+} // namespace script
+
+} // namespace reone
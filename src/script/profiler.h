@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+class IOutputStream;
+
+namespace script {
+
+/**
+ * Collects per-script and per-routine execution counters. Times are wall
+ * clock and inclusive, i.e. script time includes time spent in routines and
+ * in scripts executed by those routines.
+ */
+class ScriptProfiler : boost::noncopyable {
+public:
+    struct ScriptStats {
+        int runs {0};
+        int64_t instructions {0};
+        int64_t timeNanos {0};
+    };
+
+    struct RoutineStats {
+        int calls {0};
+        int64_t timeNanos {0};
+    };
+
+    void recordRun(const std::string &script, int64_t instructions, int64_t timeNanos);
+    void recordRoutineCall(const std::string &routine, int64_t timeNanos);
+
+    /**
+     * Writes collected counters as CSV, scripts and routines sorted by total
+     * time in descending order.
+     */
+    void save(IOutputStream &stream) const;
+
+    const std::unordered_map<std::string, ScriptStats> &scriptStats() const { return _scriptStats; }
+    const std::unordered_map<std::string, RoutineStats> &routineStats() const { return _routineStats; }
+
+private:
+    std::unordered_map<std::string, ScriptStats> _scriptStats;
+    std::unordered_map<std::string, RoutineStats> _routineStats;
+};
+
+} // namespace script
+
+} // namespace reone
@@ -34,12 +34,96 @@ void ScriptProgram::add(Instruction instr) {
         instr.nextOffset = instr.offset + size;
     }
     _length += size;
-    _insIdxByOffset.insert(make_pair(instr.offset, static_cast<int>(_instructions.size())));
+    if (instr.offset >= _insIdxByOffset.size()) {
+        _insIdxByOffset.resize(instr.offset + 1, -1);
+    }
+    _insIdxByOffset[instr.offset] = static_cast<int>(_instructions.size());
     _instructions.push_back(move(instr));
 }
 
+static bool isRSADD(InstructionType type) {
+    switch (type) {
+    case InstructionType::RSADDI:
+    case InstructionType::RSADDF:
+    case InstructionType::RSADDS:
+    case InstructionType::RSADDO:
+    case InstructionType::RSADDEFF:
+    case InstructionType::RSADDEVT:
+    case InstructionType::RSADDLOC:
+    case InstructionType::RSADDTAL:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void ScriptProgram::fuseInstructions() {
+    unordered_set<uint32_t> jumpTargets;
+    for (auto &ins : _instructions) {
+        switch (ins.type) {
+        case InstructionType::JSR:
+            jumpTargets.insert(ins.nextOffset);
+            jumpTargets.insert(ins.offset + ins.jumpOffset);
+            break;
+        case InstructionType::JMP:
+        case InstructionType::JZ:
+        case InstructionType::JNZ:
+            jumpTargets.insert(ins.offset + ins.jumpOffset);
+            break;
+        case InstructionType::STORE_STATE:
+            jumpTargets.insert(ins.offset + 0x10);
+            break;
+        default:
+            break;
+        }
+    }
+
+    auto canFuse = [this, &jumpTargets](size_t idx, int count) {
+        if (idx + count > _instructions.size()) {
+            return false;
+        }
+        for (int i = 1; i < count; ++i) {
+            if (jumpTargets.count(_instructions[idx + i].offset) > 0) {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto typeAt = [this](size_t idx) {
+        return _instructions[idx].type;
+    };
+
+    for (auto &ins : _instructions) {
+        ins.superType = SuperInstructionType::None;
+        ins.superCount = 0;
+    }
+    for (size_t i = 0; i < _instructions.size();) {
+        auto &ins = _instructions[i];
+        if (canFuse(i, 4) &&
+            ins.type == InstructionType::CPTOPSP && ins.size == 4 &&
+            typeAt(i + 1) == InstructionType::CONSTI &&
+            typeAt(i + 2) == InstructionType::EQUALII &&
+            typeAt(i + 3) == InstructionType::JZ) {
+            ins.superType = SuperInstructionType::CPTOPSP_CONSTI_EQUALII_JZ;
+            ins.superCount = 4;
+        } else if (canFuse(i, 3) &&
+                   isRSADD(ins.type) &&
+                   typeAt(i + 1) == InstructionType::CPDOWNSP &&
+                   typeAt(i + 2) == InstructionType::MOVSP) {
+            ins.superType = SuperInstructionType::RSADDx_CPDOWNSP_MOVSP;
+            ins.superCount = 3;
+        } else if (canFuse(i, 2) &&
+                   ins.type == InstructionType::CPDOWNSP &&
+                   typeAt(i + 1) == InstructionType::MOVSP) {
+            ins.superType = SuperInstructionType::CPDOWNSP_MOVSP;
+            ins.superCount = 2;
+        }
+        i += max(1, ins.superCount);
+    }
+}
+
 const Instruction &ScriptProgram::getInstruction(uint32_t offset) const {
-    int idx = _insIdxByOffset.find(offset)->second;
+    int idx = _insIdxByOffset[offset];
     return _instructions[idx];
 }
 
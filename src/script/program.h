@@ -29,6 +29,12 @@ struct Instruction {
     uint32_t nextOffset {0xffffffff};
     std::string strValue;
 
+    // Set by ScriptProgram::fuseInstructions on the first instruction of a
+    // fused sequence. Remaining instructions of the sequence follow it in
+    // the program and are skipped by the interpreter.
+    SuperInstructionType superType {SuperInstructionType::None};
+    int superCount {0};
+
     union {
         int jumpOffset {0};
         int stackOffset;
@@ -86,9 +92,16 @@ public:
 
     void add(Instruction instr);
 
+    /**
+     * Peephole pass, that marks frequent instruction sequences as
+     * superinstructions, executed by a single interpreter handler.
+     * Sequences spanning a jump target are never fused.
+     */
+    void fuseInstructions();
+
     const std::string &name() const { return _name; }
     uint32_t length() const { return _length; }
-    const std::vector<Instruction> instructions() const { return _instructions; }
+    const std::vector<Instruction> &instructions() const { return _instructions; }
 
     const Instruction &getInstruction(uint32_t offset) const;
 
@@ -99,7 +112,7 @@ private:
 
     uint32_t _length {13};
     std::vector<Instruction> _instructions;
-    std::unordered_map<uint32_t, int> _insIdxByOffset;
+    std::vector<int> _insIdxByOffset; /**< instruction indices by offset, -1 between instructions */
 };
 
 } // namespace script
@@ -29,7 +29,7 @@ namespace reone {
 
 namespace script {
 
-Variable Routine::invoke(const vector<Variable> &args, ExecutionContext &ctx) {
+Variable Routine::invoke(const ArgumentSpan &args, ExecutionContext &ctx) {
     try {
         return _func(args, ctx);
     } catch (const NotImplementedException &ex) {
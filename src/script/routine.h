@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "argumentspan.h"
 #include "types.h"
 #include "variable.h"
 
@@ -33,7 +34,7 @@ public:
         VariableType retType,
         Variable defRetValue,
         std::vector<VariableType> argTypes,
-        std::function<Variable(const std::vector<Variable> &, ExecutionContext &ctx)> fn) :
+        std::function<Variable(const ArgumentSpan &, ExecutionContext &ctx)> fn) :
         _name(std::move(name)),
         _returnType(retType),
         _defaultReturnValue(std::move(defRetValue)),
@@ -41,7 +42,7 @@ public:
         _func(std::move(fn)) {
     }
 
-    virtual Variable invoke(const std::vector<Variable> &args, ExecutionContext &ctx);
+    virtual Variable invoke(const ArgumentSpan &args, ExecutionContext &ctx);
 
     int getArgumentCount() const;
     VariableType getArgumentType(int index) const;
@@ -54,7 +55,7 @@ private:
     VariableType _returnType {VariableType::Void};
     Variable _defaultReturnValue;
     std::vector<VariableType> _argumentTypes;
-    std::function<Variable(const std::vector<Variable> &, ExecutionContext &ctx)> _func;
+    std::function<Variable(const ArgumentSpan &, ExecutionContext &ctx)> _func;
 
     Variable onException(const std::string &msg, const std::exception &ex) const;
 };
@@ -17,6 +17,7 @@
 
 #include "scripts.h"
 
+#include "../common/logutil.h"
 #include "../common/stream/bytearrayinput.h"
 
 #include "format/ncsreader.h"
@@ -30,21 +31,86 @@ namespace reone {
 
 namespace script {
 
+static constexpr int kMaxPrecompileThreads = 4;
+
+static shared_ptr<ScriptProgram> decodeProgram(const string &resRef, ByteArray &data) {
+    auto ncs = ByteArrayInputStream(data);
+    auto reader = NcsReader(resRef);
+    reader.load(ncs);
+
+    auto program = reader.program();
+    program->fuseInstructions();
+
+    return move(program);
+}
+
 Scripts::Scripts(Resources &resources) :
     MemoryCache(bind(&Scripts::doGet, this, _1)),
     _resources(resources) {
 }
 
+void Scripts::precompile(const set<string> &resRefs) {
+    // Wait for workers of the previous batch, and discard its unrequested programs
+    _workers.clear();
+    _pending.clear();
+
+    // Resources are not thread-safe, therefore script data is read up front
+    auto batch = make_shared<vector<PrecompileItem>>();
+    for (auto &resRef : resRefs) {
+        if (_objects.count(resRef) > 0) {
+            continue;
+        }
+        shared_ptr<ByteArray> data(_resources.get(resRef, ResourceType::Ncs, false));
+        if (data) {
+            PrecompileItem item;
+            item.resRef = resRef;
+            item.data = move(data);
+            batch->push_back(move(item));
+        }
+    }
+    if (batch->empty()) {
+        return;
+    }
+    for (auto &item : *batch) {
+        _pending[item.resRef] = item.program.get_future().share();
+    }
+
+    int numItems = static_cast<int>(batch->size());
+    int numThreads = max(1, min(static_cast<int>(thread::hardware_concurrency()), kMaxPrecompileThreads));
+    numThreads = min(numThreads, numItems);
+
+    for (int i = 0; i < numThreads; ++i) {
+        _workers.push_back(async(launch::async, [batch, i, numThreads, numItems]() {
+            for (int j = i; j < numItems; j += numThreads) {
+                auto &item = (*batch)[j];
+                try {
+                    item.program.set_value(decodeProgram(item.resRef, *item.data));
+                } catch (const exception &) {
+                    // Decoding will be retried, and errors reported, on first use
+                    item.program.set_value(nullptr);
+                }
+            }
+        }));
+    }
+
+    debug(boost::format("Precompiling %d scripts on %d threads") % numItems % numThreads, LogChannels::script);
+}
+
 shared_ptr<ScriptProgram> Scripts::doGet(string resRef) {
+    auto maybePending = _pending.find(resRef);
+    if (maybePending != _pending.end()) {
+        auto program = maybePending->second.get();
+        _pending.erase(maybePending);
+        if (program) {
+            return move(program);
+        }
+    }
+
     shared_ptr<ByteArray> data(_resources.get(resRef, ResourceType::Ncs));
     if (!data)
         return nullptr;
 
-    auto ncs = ByteArrayInputStream(*data);
-    auto reader = NcsReader(resRef);
-    reader.load(ncs);
-
-    return reader.program();
+    return decodeProgram(resRef, *data);
 }
 
 } // namespace script
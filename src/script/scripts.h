@@ -30,9 +30,25 @@ class Scripts : public MemoryCache<std::string, ScriptProgram> {
 public:
     Scripts(resource::Resources &resources);
 
+    /**
+     * Decodes specified script programs on worker threads, ahead of their
+     * first use. Programs are moved into this cache when requested.
+     * Programs precompiled previously, but never requested, are discarded.
+     */
+    void precompile(const std::set<std::string> &resRefs);
+
 private:
+    struct PrecompileItem {
+        std::string resRef;
+        std::shared_ptr<ByteArray> data;
+        std::promise<std::shared_ptr<ScriptProgram>> program;
+    };
+
     resource::Resources &_resources;
 
+    std::unordered_map<std::string, std::shared_future<std::shared_ptr<ScriptProgram>>> _pending;
+    std::vector<std::future<void>> _workers;
+
     std::shared_ptr<ScriptProgram> doGet(std::string resRef);
 };
 
@@ -199,6 +199,13 @@ enum class InstructionType {
 
 #define R_INSTR_TYPE(a, b) static_cast<InstructionType>(R_INSTR_TYPE_VAL(a, b))
 
+enum class SuperInstructionType {
+    None,
+    CPTOPSP_CONSTI_EQUALII_JZ,
+    RSADDx_CPDOWNSP_MOVSP,
+    CPDOWNSP_MOVSP
+};
+
 enum class VariableType {
     Void,
     Int,
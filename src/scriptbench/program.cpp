@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "program.h"
+
+#include "../common/stream/fileinput.h"
+#include "../game/script/routines.h"
+#include "../script/execution.h"
+#include "../script/executioncontext.h"
+#include "../script/format/ncsreader.h"
+#include "../script/profiler.h"
+#include "../script/program.h"
+
+#include "routines.h"
+
+using namespace std;
+
+using namespace reone::game;
+using namespace reone::script;
+
+namespace fs = boost::filesystem;
+namespace po = boost::program_options;
+
+namespace reone {
+
+static constexpr int kDefaultNumRuns = 100;
+
+int Program::run() {
+    initOptions();
+    parseOptions();
+    loadOptions();
+
+    if (_input.empty()) {
+        cout << _optsCmdLine << endl;
+        return 0;
+    }
+
+    // Game routines are only used as a source of signatures
+    auto gameRoutines = Routines(_gameId);
+    gameRoutines.init();
+
+    auto routines = StubRoutines();
+    routines.init(gameRoutines);
+
+    cout << boost::format("%-24s %16s %16s %16s") % "script" % "instructions" % "us/run" % "Minstr/s" << endl;
+
+    int64_t totalInstructions = 0;
+    double totalSeconds = 0.0;
+
+    for (auto &path : _input) {
+        Result result;
+        try {
+            result = benchmark(path, routines);
+        } catch (const exception &ex) {
+            cerr << "Unable to benchmark " << path << ": " << ex.what() << endl;
+            continue;
+        }
+        int64_t instructions = result.instructions * _runs;
+        cout << boost::format("%-24s %16d %16.3f %16.3f") %
+                    result.script %
+                    result.instructions %
+                    (1e6 * result.seconds / _runs) %
+                    (instructions / result.seconds / 1e6)
+             << endl;
+
+        totalInstructions += instructions;
+        totalSeconds += result.seconds;
+    }
+
+    if (totalSeconds > 0.0) {
+        cout << boost::format("Total: %d instructions in %.3f s, %.3f Minstr/s") %
+                    totalInstructions %
+                    totalSeconds %
+                    (totalInstructions / totalSeconds / 1e6)
+             << endl;
+    }
+
+    return 0;
+}
+
+void Program::initOptions() {
+    _optsCmdLine.add_options()                                                                  //
+        ("tsl", po::value<bool>()->default_value(false), "use TSL routines")                    //
+        ("runs", po::value<int>()->default_value(kDefaultNumRuns), "number of runs per script") //
+        ("input", po::value<vector<string>>()->multitoken(), "paths to NCS files/directories");  //
+}
+
+void Program::parseOptions() {
+    po::positional_options_description positional;
+    positional.add("input", -1);
+
+    po::parsed_options parsedCmdLineOpts = po::command_line_parser(_argc, _argv)
+                                               .options(_optsCmdLine)
+                                               .positional(positional)
+                                               .run();
+
+    po::store(parsedCmdLineOpts, _variables);
+    po::notify(_variables);
+}
+
+void Program::loadOptions() {
+    if (_variables.count("input") > 0) {
+        for (auto &input : _variables["input"].as<vector<string>>()) {
+            auto path = fs::path(input);
+            if (!fs::is_directory(path)) {
+                _input.push_back(path);
+                continue;
+            }
+            vector<fs::path> scripts;
+            for (auto &entry : fs::directory_iterator(path)) {
+                if (boost::iequals(entry.path().extension().string(), ".ncs")) {
+                    scripts.push_back(entry.path());
+                }
+            }
+            sort(scripts.begin(), scripts.end());
+            _input.insert(_input.end(), scripts.begin(), scripts.end());
+        }
+    }
+    _gameId = _variables["tsl"].as<bool>() ? GameID::TSL : GameID::KotOR;
+    _runs = max(1, _variables["runs"].as<int>());
+}
+
+Program::Result Program::benchmark(const fs::path &path, IRoutines &routines) {
+    auto stream = FileInputStream(path, OpenMode::Binary);
+
+    auto reader = NcsReader(path.stem().string());
+    reader.load(stream);
+
+    auto program = reader.program();
+    program->fuseInstructions();
+
+    // Warm-up run, also counts executed instructions
+    auto profiler = ScriptProfiler();
+    auto execution = ScriptExecution(program, newContext(routines, &profiler));
+    execution.run();
+
+    // Timed runs reuse the execution, so that only script execution is measured
+    auto contexts = vector<unique_ptr<ExecutionContext>>();
+    for (int i = 0; i < _runs; ++i) {
+        contexts.push_back(newContext(routines, nullptr));
+    }
+    auto startTime = chrono::steady_clock::now();
+    for (auto &context : contexts) {
+        execution.reset(program, move(context));
+        execution.run();
+    }
+    auto time = chrono::duration<double>(chrono::steady_clock::now() - startTime);
+
+    Result result;
+    result.script = program->name();
+    result.instructions = profiler.scriptStats().at(program->name()).instructions;
+    result.seconds = time.count();
+
+    return move(result);
+}
+
+unique_ptr<ExecutionContext> Program::newContext(IRoutines &routines, ScriptProfiler *profiler) {
+    auto ctx = make_unique<ExecutionContext>();
+    ctx->routines = &routines;
+    ctx->profiler = profiler;
+    return move(ctx);
+}
+
+} // namespace reone
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <boost/program_options.hpp>
+
+#include "../game/types.h"
+
+namespace reone {
+
+namespace script {
+
+struct ExecutionContext;
+
+class IRoutines;
+class ScriptProfiler;
+class ScriptProgram;
+
+} // namespace script
+
+class Program : boost::noncopyable {
+public:
+    Program(int argc, char **argv) :
+        _argc(argc), _argv(argv) {
+    }
+
+    int run();
+
+private:
+    struct Result {
+        std::string script;
+        int64_t instructions {0}; /**< instructions executed per run */
+        double seconds {0.0};     /**< total time of all timed runs */
+    };
+
+    int _argc;
+    char **_argv;
+
+    boost::program_options::options_description _optsCmdLine {"Usage"};
+    boost::program_options::variables_map _variables;
+
+    std::vector<boost::filesystem::path> _input;
+
+    game::GameID _gameId {game::GameID::KotOR};
+    int _runs {0};
+
+    void initOptions();
+    void parseOptions();
+    void loadOptions();
+
+    Result benchmark(const boost::filesystem::path &path, script::IRoutines &routines);
+    std::unique_ptr<script::ExecutionContext> newContext(script::IRoutines &routines, script::ScriptProfiler *profiler);
+};
+
+} // namespace reone
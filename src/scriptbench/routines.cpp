@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "routines.h"
+
+#include "../common/collectionutil.h"
+#include "../script/variable.h"
+
+using namespace std;
+
+using namespace reone::script;
+
+namespace reone {
+
+static Variable getDefaultValue(VariableType type) {
+    switch (type) {
+    case VariableType::Int:
+        return Variable::ofInt(0);
+    case VariableType::Float:
+        return Variable::ofFloat(0.0f);
+    case VariableType::String:
+        return Variable::ofString("");
+    case VariableType::Vector:
+        return Variable::ofVector(glm::vec3(0.0f));
+    case VariableType::Object:
+        return Variable::ofObject(kObjectInvalid);
+    case VariableType::Effect:
+        return Variable::ofEffect(nullptr);
+    case VariableType::Event:
+        return Variable::ofEvent(nullptr);
+    case VariableType::Location:
+        return Variable::ofLocation(nullptr);
+    case VariableType::Talent:
+        return Variable::ofTalent(nullptr);
+    default:
+        return Variable();
+    }
+}
+
+void StubRoutines::init(IRoutines &routines) {
+    for (int i = 0; i < routines.getNumRoutines(); ++i) {
+        auto &routine = routines.get(i);
+
+        vector<VariableType> argTypes;
+        for (int j = 0; j < routine.getArgumentCount(); ++j) {
+            argTypes.push_back(routine.getArgumentType(j));
+        }
+        auto retValue = getDefaultValue(routine.returnType());
+
+        _routines.emplace_back(
+            routine.name(),
+            routine.returnType(),
+            retValue,
+            move(argTypes),
+            [retValue](auto &args, auto &ctx) { return retValue; });
+    }
+}
+
+Routine &StubRoutines::get(int index) {
+    if (isOutOfRange(_routines, index)) {
+        throw out_of_range("index is out of range");
+    }
+    return _routines[index];
+}
+
+int StubRoutines::getIndexByName(const string &name) const {
+    for (size_t i = 0; i < _routines.size(); ++i) {
+        if (_routines[i].name() == name) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+} // namespace reone
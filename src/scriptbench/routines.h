@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../script/routine.h"
+#include "../script/routines.h"
+
+namespace reone {
+
+/**
+ * Routines with the signatures of the game routines, that return default
+ * values without touching game state.
+ */
+class StubRoutines : public script::IRoutines {
+public:
+    /**
+     * Creates a stub for every routine in the specified routine set.
+     */
+    void init(script::IRoutines &routines);
+
+    script::Routine &get(int index) override;
+
+    int getNumRoutines() const override { return static_cast<int>(_routines.size()); }
+    int getIndexByName(const std::string &name) const override;
+
+private:
+    std::vector<script::Routine> _routines;
+};
+
+} // namespace reone
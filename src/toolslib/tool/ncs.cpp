@@ -57,7 +57,7 @@ void NcsTool::invokeBatch(
     const fs::path &outputDir,
     const fs::path &gamePath) {
 
-    auto routines = Routines(_gameId, *static_cast<Game *>(nullptr), *static_cast<ServicesView *>(nullptr));
+    auto routines = Routines(_gameId);
     routines.init();
 
     return doInvokeBatch(input, outputDir, [this, &operation, &routines](auto &path, auto &outDir) {
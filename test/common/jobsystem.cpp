@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include "../../src/common/jobsystem.h"
+
+using namespace std;
+
+using namespace reone;
+
+BOOST_AUTO_TEST_SUITE(job_system)
+
+BOOST_AUTO_TEST_CASE(should_process_range_in_parallel) {
+    // given
+    auto jobSystem = JobSystem(4);
+    auto values = vector<int>(1000, 0);
+
+    // when
+    jobSystem.parallelFor(0, static_cast<int>(values.size()), 64, [&values](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            values[i] = i;
+        }
+    });
+
+    // then
+    for (int i = 0; i < static_cast<int>(values.size()); ++i) {
+        BOOST_CHECK_EQUAL(i, values[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(should_wait_for_nested_jobs) {
+    // given
+    auto jobSystem = JobSystem(2);
+    auto group = JobSystem::JobGroup();
+    auto counter = atomic<int>(0);
+
+    auto job = [&jobSystem, &counter]() {
+        jobSystem.parallelFor(0, 16, 1, [&counter](int begin, int end) {
+            counter += end - begin;
+        });
+    };
+
+    // when
+    for (int i = 0; i < 8; ++i) {
+        jobSystem.submit(job, group);
+    }
+    jobSystem.wait(group);
+
+    // then
+    BOOST_CHECK(group.isDone());
+    BOOST_CHECK_EQUAL(128, counter.load());
+}
+
+BOOST_AUTO_TEST_CASE(should_run_tasks_after_their_dependencies) {
+    // given
+    auto jobSystem = JobSystem(4);
+    auto order = vector<int>();
+    auto orderMutex = mutex();
+    auto record = [&order, &orderMutex](int value) {
+        lock_guard<mutex> lock(orderMutex);
+        order.push_back(value);
+    };
+    auto graph = TaskGraph();
+    auto a = graph.add([&record]() { record(0); });
+    auto b = graph.add([&record]() { record(1); }, {a});
+    auto c = graph.add([&record]() { record(1); }, {a});
+    graph.add([&record]() { record(2); }, {b, c});
+
+    // when
+    graph.run(jobSystem);
+    graph.run(jobSystem);
+
+    // then
+    auto expectedOrder = vector<int> {0, 1, 1, 2, 0, 1, 1, 2};
+    BOOST_TEST((expectedOrder == order));
+}
+
+BOOST_AUTO_TEST_CASE(should_rethrow_job_exception_on_wait) {
+    // given
+    auto jobSystem = JobSystem(2);
+    auto group = JobSystem::JobGroup();
+    jobSystem.submit([]() { throw logic_error("Job failed"); }, group);
+    jobSystem.submit([]() {}, group);
+
+    // when, then
+    BOOST_CHECK_THROW(jobSystem.wait(group), logic_error);
+    BOOST_CHECK(group.isDone());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
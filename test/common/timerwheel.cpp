@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include "../../src/common/timerwheel.h"
+
+using namespace std;
+
+using namespace reone;
+
+BOOST_AUTO_TEST_SUITE(timer_wheel)
+
+BOOST_AUTO_TEST_CASE(should_expire_values_in_order_of_expiry) {
+    // given
+    auto wheel = TimerWheel<int>(0.01f);
+    wheel.schedule(0.05f, 2);
+    wheel.schedule(0.02f, 1);
+    wheel.schedule(1.0f, 3);
+    wheel.schedule(0.0f, 0);
+    auto expired = vector<int>();
+
+    // when
+    wheel.advance(0.01f, expired);
+    wheel.advance(0.02f, expired);
+    auto expiredEarly = expired;
+    wheel.advance(2.0f, expired);
+
+    // then
+    BOOST_CHECK_EQUAL(2ll, expiredEarly.size());
+    BOOST_CHECK_EQUAL(0, expiredEarly[0]);
+    BOOST_CHECK_EQUAL(1, expiredEarly[1]);
+    BOOST_CHECK_EQUAL(4ll, expired.size());
+    BOOST_CHECK_EQUAL(2, expired[2]);
+    BOOST_CHECK_EQUAL(3, expired[3]);
+    BOOST_CHECK_EQUAL(0, wheel.size());
+}
+
+BOOST_AUTO_TEST_CASE(should_expire_values_across_wheel_levels) {
+    // given
+    auto wheel = TimerWheel<float>(0.01f);
+    auto delays = vector<float> {0.5f, 0.64f, 0.65f, 3.0f, 40.96f, 100.0f, 300.0f};
+    for (auto delay : delays) {
+        wheel.schedule(delay, delay);
+    }
+    auto expired = vector<float>();
+
+    // when
+    auto expiryTimes = vector<double>();
+    double time = 0.0;
+    while (time < 301.0) {
+        wheel.advance(0.05f, expired);
+        time += 0.05;
+        while (expiryTimes.size() < expired.size()) {
+            expiryTimes.push_back(time);
+        }
+    }
+
+    // then
+    BOOST_CHECK_EQUAL(7ll, expired.size());
+    for (size_t i = 0; i < expired.size(); ++i) {
+        BOOST_CHECK_CLOSE(delays[i], expired[i], 1e-5);
+        BOOST_CHECK(fabs(expiryTimes[i] - delays[i]) < 0.1f);
+    }
+    BOOST_CHECK_EQUAL(0, wheel.size());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include "../../src/common/stream/bytearrayoutput.h"
+#include "../../src/common/traceutil.h"
+
+using namespace std;
+
+using namespace reone;
+
+BOOST_AUTO_TEST_SUITE(trace_util)
+
+BOOST_AUTO_TEST_CASE(should_save_recorded_zones_as_chrome_trace) {
+    // given
+    setTracingEnabled(true);
+    {
+        R_TRACE_ZONE("should_save_recorded_zones");
+    }
+    setTracingEnabled(false);
+    {
+        R_TRACE_ZONE("should_skip_zones_when_disabled");
+    }
+
+    // when
+    auto bytes = ByteArray();
+    auto stream = ByteArrayOutputStream(bytes);
+    saveTrace(stream);
+
+    // then
+    auto json = string(bytes.begin(), bytes.end());
+    BOOST_TEST((json.find("{\"traceEvents\":[") == 0));
+    BOOST_TEST((json.find("{\"name\":\"should_save_recorded_zones\",\"ph\":\"X\"") != string::npos));
+    BOOST_TEST((json.find("should_skip_zones_when_disabled") == string::npos));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
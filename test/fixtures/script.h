@@ -41,8 +41,12 @@ public:
             [retValue](auto &args, auto &ctx) { return retValue; }) {
     }
 
-    Variable invoke(const std::vector<Variable> &args, ExecutionContext &ctx) override {
-        _invokeInvocations.push_back(make_tuple(args, ctx));
+    Variable invoke(const ArgumentSpan &args, ExecutionContext &ctx) override {
+        std::vector<Variable> argsCopy;
+        for (int i = 0; i < args.size(); ++i) {
+            argsCopy.push_back(args[i]);
+        }
+        _invokeInvocations.push_back(make_tuple(std::move(argsCopy), ctx));
         return Routine::invoke(args, ctx);
     }
 
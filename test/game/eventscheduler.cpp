@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include "../../game/eventscheduler.h"
+
+using namespace std;
+
+using namespace reone;
+using namespace reone::game;
+
+BOOST_AUTO_TEST_SUITE(event_scheduler)
+
+BOOST_AUTO_TEST_CASE(should_stagger_heartbeats_across_updates) {
+    // given
+    auto scheduler = EventScheduler();
+    scheduler.setPeriod(PeriodicEventType::Heartbeat, 8.0f);
+    for (uint32_t id = 0; id < 128; ++id) {
+        scheduler.add(id, PeriodicEventType::Heartbeat);
+    }
+    auto due = vector<EventScheduler::Event>();
+    auto numFired = vector<int>();
+
+    // when
+    for (int i = 0; i < 64; ++i) {
+        scheduler.update(0.125f, due);
+        numFired.push_back(scheduler.numFired(PeriodicEventType::Heartbeat));
+    }
+
+    // then
+    BOOST_CHECK_EQUAL(128ll, due.size());
+    for (auto &count : numFired) {
+        BOOST_CHECK_EQUAL(2, count);
+    }
+    auto ids = set<uint32_t>();
+    for (auto &event : due) {
+        ids.insert(event.objectId);
+    }
+    BOOST_CHECK_EQUAL(128ll, ids.size());
+}
+
+BOOST_AUTO_TEST_CASE(should_fire_forced_and_skip_removed_events) {
+    // given
+    auto scheduler = EventScheduler();
+    scheduler.add(1, PeriodicEventType::Heartbeat);
+    scheduler.add(2, PeriodicEventType::Heartbeat);
+    scheduler.add(3, PeriodicEventType::Perception);
+    auto due = vector<EventScheduler::Event>();
+
+    // when
+    scheduler.remove(2, PeriodicEventType::Heartbeat);
+    scheduler.force(2, PeriodicEventType::Heartbeat);
+    scheduler.update(0.0f, due);
+
+    // then
+    BOOST_CHECK(!scheduler.contains(2, PeriodicEventType::Heartbeat));
+    BOOST_CHECK(scheduler.contains(3, PeriodicEventType::Perception));
+    BOOST_CHECK_EQUAL(1ll, due.size());
+    BOOST_CHECK_EQUAL(2, due[0].objectId);
+    BOOST_CHECK_EQUAL(1, scheduler.numFired(PeriodicEventType::Heartbeat));
+
+    // when
+    due.clear();
+    scheduler.update(60.0f, due);
+
+    // then
+    BOOST_CHECK_EQUAL(2ll, due.size());
+    BOOST_CHECK_EQUAL(1, scheduler.numFired(PeriodicEventType::Heartbeat));
+    BOOST_CHECK_EQUAL(1, scheduler.numFired(PeriodicEventType::Perception));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
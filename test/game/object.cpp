@@ -18,9 +18,11 @@
 #include <boost/test/unit_test.hpp>
 
 #include "../../src/game/object.h"
+#include "../../src/scene/node/sound.h"
 
 #include "../fixtures/functional.h"
 #include "../fixtures/game.h"
+#include "../fixtures/scene.h"
 
 using namespace reone;
 using namespace reone::game;
@@ -57,4 +59,27 @@ BOOST_AUTO_TEST_CASE(should_execute_queued_actions_one_per_frame) {
     BOOST_CHECK_EQUAL(2ll, action3->executeInvocations().size());
 }
 
+BOOST_AUTO_TEST_CASE(should_interpolate_scene_node_transform_between_simulation_steps) {
+    // given
+    auto test = FunctionalTest();
+    auto game = test.mockGame();
+    auto &scene = test.sceneMockByName(kSceneMain);
+    auto sceneNode = scene.newSound();
+
+    auto creature = game->mockCreature();
+    creature->setSceneNode(sceneNode.get());
+    creature->setPosition(glm::vec3(0.0f));
+    creature->savePreviousTransform();
+    creature->setPosition(glm::vec3(2.0f, 4.0f, 0.0f));
+
+    // when
+    creature->interpolateTransform(0.25f);
+
+    // then
+    auto position = glm::vec3(sceneNode->localTransform()[3]);
+    BOOST_CHECK_CLOSE(0.5f, position.x, 1e-4f);
+    BOOST_CHECK_CLOSE(1.0f, position.y, 1e-4f);
+    BOOST_CHECK_SMALL(position.z, 1e-4f);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
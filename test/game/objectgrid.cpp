@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include "../../src/game/objectgrid.h"
+
+#include "../fixtures/functional.h"
+#include "../fixtures/game.h"
+
+using namespace std;
+
+using namespace reone;
+using namespace reone::game;
+
+BOOST_AUTO_TEST_SUITE(object_grid)
+
+BOOST_AUTO_TEST_CASE(should_find_objects_in_radius) {
+    // given
+    auto test = FunctionalTest();
+    auto game = test.mockGame();
+
+    auto creature1 = game->mockCreature();
+    creature1->setPosition(glm::vec3(1.0f, 1.0f, 0.0f));
+    auto creature2 = game->mockCreature();
+    creature2->setPosition(glm::vec3(-2.0f, 9.0f, 0.0f));
+    auto creature3 = game->mockCreature();
+    creature3->setPosition(glm::vec3(20.0f, 20.0f, 0.0f));
+
+    auto grid = ObjectGrid(4.0f);
+    grid.add(*creature1);
+    grid.add(*creature2);
+    grid.add(*creature3);
+
+    // when
+    auto objects = vector<Object *>();
+    grid.objectsInRadius(glm::vec2(0.0f, 5.0f), 5.0f, static_cast<int>(ObjectType::Creature), objects);
+
+    // then
+    BOOST_REQUIRE_EQUAL(2ll, objects.size());
+    BOOST_CHECK(find(objects.begin(), objects.end(), creature1.get()) != objects.end());
+    BOOST_CHECK(find(objects.begin(), objects.end(), creature2.get()) != objects.end());
+}
+
+BOOST_AUTO_TEST_CASE(should_find_moved_object_in_radius) {
+    // given
+    auto test = FunctionalTest();
+    auto game = test.mockGame();
+
+    auto creature = game->mockCreature();
+    creature->setPosition(glm::vec3(1.0f, 1.0f, 0.0f));
+
+    auto grid = ObjectGrid(4.0f);
+    grid.add(*creature);
+
+    creature->setPosition(glm::vec3(30.0f, 30.0f, 0.0f));
+    grid.update(*creature);
+
+    // when
+    auto objectsAtOldPosition = vector<Object *>();
+    grid.objectsInRadius(glm::vec2(1.0f, 1.0f), 2.0f, static_cast<int>(ObjectType::All), objectsAtOldPosition);
+    auto objectsAtNewPosition = vector<Object *>();
+    grid.objectsInRadius(glm::vec2(30.0f, 30.0f), 2.0f, static_cast<int>(ObjectType::All), objectsAtNewPosition);
+
+    // then
+    BOOST_CHECK_EQUAL(0ll, objectsAtOldPosition.size());
+    BOOST_REQUIRE_EQUAL(1ll, objectsAtNewPosition.size());
+    BOOST_CHECK_EQUAL(creature.get(), objectsAtNewPosition[0]);
+}
+
+BOOST_AUTO_TEST_CASE(should_find_nth_nearest_object) {
+    // given
+    auto test = FunctionalTest();
+    auto game = test.mockGame();
+
+    auto creature1 = game->mockCreature();
+    creature1->setPosition(glm::vec3(3.0f, 0.0f, 0.0f));
+    auto creature2 = game->mockCreature();
+    creature2->setPosition(glm::vec3(0.0f, 1.0f, 0.0f));
+    auto creature3 = game->mockCreature();
+    creature3->setPosition(glm::vec3(-25.0f, 0.0f, 0.0f));
+
+    auto grid = ObjectGrid(4.0f);
+    grid.add(*creature1);
+    grid.add(*creature2);
+    grid.add(*creature3);
+
+    auto any = [](auto &object) { return true; };
+
+    // when
+    auto nearest = grid.nearestObject(glm::vec2(0.0f), 0, any);
+    auto secondNearest = grid.nearestObject(glm::vec2(0.0f), 1, any);
+    auto thirdNearest = grid.nearestObject(glm::vec2(0.0f), 2, any);
+    auto fourthNearest = grid.nearestObject(glm::vec2(0.0f), 3, any);
+
+    // then
+    BOOST_CHECK_EQUAL(creature2.get(), nearest);
+    BOOST_CHECK_EQUAL(creature1.get(), secondNearest);
+    BOOST_CHECK_EQUAL(creature3.get(), thirdNearest);
+    BOOST_CHECK(!fourthNearest);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
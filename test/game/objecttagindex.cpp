@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include "../../src/game/objecttagindex.h"
+
+#include "../fixtures/functional.h"
+#include "../fixtures/game.h"
+
+using namespace std;
+
+using namespace reone;
+using namespace reone::game;
+
+BOOST_AUTO_TEST_SUITE(object_tag_index)
+
+BOOST_AUTO_TEST_CASE(should_get_nth_object_by_tag) {
+    // given
+    auto test = FunctionalTest();
+    auto game = test.mockGame();
+
+    auto creature1 = game->mockCreature();
+    creature1->setTag("Guard");
+    auto creature2 = game->mockCreature();
+    creature2->setTag("other");
+    auto creature3 = game->mockCreature();
+    creature3->setTag("guard");
+
+    auto index = ObjectTagIndex();
+    index.add(*creature3);
+    index.add(*creature2);
+    index.add(*creature1);
+
+    // when
+    auto first = index.get("GUARD", 0);
+    auto second = index.get("guard", 1);
+    auto third = index.get("guard", 2);
+    auto unknown = index.get("unknown");
+
+    // then
+    BOOST_CHECK_EQUAL(creature1.get(), first);
+    BOOST_CHECK_EQUAL(creature3.get(), second);
+    BOOST_CHECK(!third);
+    BOOST_CHECK(!unknown);
+}
+
+BOOST_AUTO_TEST_CASE(should_get_object_by_changed_tag) {
+    // given
+    auto test = FunctionalTest();
+    auto game = test.mockGame();
+
+    auto creature = game->mockCreature();
+    creature->setTag("old_tag");
+
+    auto index = ObjectTagIndex();
+    index.add(*creature);
+
+    creature->setTag("new_tag");
+
+    // when
+    index.update(*creature, "old_tag");
+
+    // then
+    BOOST_CHECK(!index.get("old_tag"));
+    BOOST_CHECK_EQUAL(creature.get(), index.get("new_tag"));
+}
+
+BOOST_AUTO_TEST_CASE(should_not_get_removed_object_by_tag) {
+    // given
+    auto test = FunctionalTest();
+    auto game = test.mockGame();
+
+    auto creature = game->mockCreature();
+    creature->setTag("some_tag");
+
+    auto index = ObjectTagIndex();
+    index.add(*creature);
+
+    // when
+    index.remove(*creature);
+
+    // then
+    BOOST_CHECK(!index.get("some_tag"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include "../../src/graphics/animatedproperty.h"
+
+using namespace std;
+
+using namespace reone;
+using namespace reone::graphics;
+
+BOOST_AUTO_TEST_SUITE(animated_property)
+
+BOOST_AUTO_TEST_CASE(should_interpolate_between_surrounding_keyframes) {
+    // given
+    auto property = AnimatedProperty<float>();
+    property.addFrame(0.0f, 0.0f);
+    property.addFrame(1.0f, 10.0f);
+    property.addFrame(2.0f, 30.0f);
+    property.addFrame(3.0f, 60.0f);
+
+    // when
+    float value1 = -1.0f;
+    bool found1 = property.getByTime(0.0f, value1);
+    float value2 = -1.0f;
+    bool found2 = property.getByTime(1.5f, value2);
+    float value3 = -1.0f;
+    bool found3 = property.getByTime(3.0f, value3);
+
+    // then
+    BOOST_CHECK(found1);
+    BOOST_CHECK_CLOSE(0.0f, value1, 1e-5);
+    BOOST_CHECK(found2);
+    BOOST_CHECK_CLOSE(20.0f, value2, 1e-5);
+    BOOST_CHECK(found3);
+    BOOST_CHECK_CLOSE(60.0f, value3, 1e-5);
+}
+
+BOOST_AUTO_TEST_CASE(should_interpolate_between_surrounding_keyframes_using_cursor) {
+    // given
+    auto property = AnimatedProperty<float>();
+    property.addFrame(0.0f, 0.0f);
+    property.addFrame(1.0f, 10.0f);
+    property.addFrame(2.0f, 30.0f);
+    property.addFrame(3.0f, 60.0f);
+
+    int cursor = 0;
+    float value = -1.0f;
+
+    // when
+    property.getByTime(0.5f, value, cursor);
+    float value1 = value;
+    int cursor1 = cursor;
+    property.getByTime(1.5f, value, cursor);
+    float value2 = value;
+    int cursor2 = cursor;
+    property.getByTime(0.25f, value, cursor);
+    float value3 = value;
+    int cursor3 = cursor;
+    property.getByTime(2.5f, value, cursor);
+    float value4 = value;
+    int cursor4 = cursor;
+
+    // then
+    BOOST_CHECK_CLOSE(5.0f, value1, 1e-5);
+    BOOST_CHECK_EQUAL(1, cursor1);
+    BOOST_CHECK_CLOSE(20.0f, value2, 1e-5);
+    BOOST_CHECK_EQUAL(2, cursor2);
+    BOOST_CHECK_CLOSE(2.5f, value3, 1e-5);
+    BOOST_CHECK_EQUAL(1, cursor3);
+    BOOST_CHECK_CLOSE(45.0f, value4, 1e-5);
+    BOOST_CHECK_EQUAL(3, cursor4);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -20,6 +20,7 @@
 #include "../../../src/common/stream/bytearrayinput.h"
 #include "../../../src/common/stringbuilder.h"
 #include "../../../src/graphics/format/bwmreader.h"
+#include "../../../src/graphics/walkmesh.h"
 
 using namespace reone;
 using namespace reone::graphics;
@@ -63,6 +64,84 @@ BOOST_AUTO_TEST_CASE(should_load_pwk_dwk) {
     auto walkmesh = reader.walkmesh();
 }
 
+BOOST_AUTO_TEST_CASE(should_build_aabb_tree_for_pwk_dwk) {
+    // given
+    auto pwkBytes = StringBuilder()
+                        .append("BWM V1.0")
+                        .append("\x00\x00\x00\x00", 4) // type
+                        .append("\x00\x00\x00\x00", 4) // relative use position 1 (X)
+                        .append("\x00\x00\x00\x00", 4) // relative use position 1 (Y)
+                        .append("\x00\x00\x00\x00", 4) // relative use position 1 (Z)
+                        .append("\x00\x00\x00\x00", 4) // relative use position 2 (X)
+                        .append("\x00\x00\x00\x00", 4) // relative use position 2 (Y)
+                        .append("\x00\x00\x00\x00", 4) // relative use position 2 (Z)
+                        .append("\x00\x00\x00\x00", 4) // absolute use position 1 (X)
+                        .append("\x00\x00\x00\x00", 4) // absolute use position 1 (Y)
+                        .append("\x00\x00\x00\x00", 4) // absolute use position 1 (Z)
+                        .append("\x00\x00\x00\x00", 4) // absolute use position 2 (X)
+                        .append("\x00\x00\x00\x00", 4) // absolute use position 2 (Y)
+                        .append("\x00\x00\x00\x00", 4) // absolute use position 2 (Z)
+                        .append("\x00\x00\x00\x00", 4) // position (X)
+                        .append("\x00\x00\x00\x00", 4) // position (Y)
+                        .append("\x00\x00\x00\x00", 4) // position (Z)
+                        .append("\x06\x00\x00\x00", 4) // number of vertices
+                        .append("\x64\x00\x00\x00", 4) // offset to vertices
+                        .append("\x02\x00\x00\x00", 4) // number of faces
+                        .append("\xac\x00\x00\x00", 4) // offset to indices
+                        .append("\xc4\x00\x00\x00", 4) // offset to materials
+                        .append("\xcc\x00\x00\x00", 4) // offset to normals
+                        .append("\xe4\x00\x00\x00", 4) // offset to planar distances
+                        .append("\x00\x00\x80\xbf", 4) // vertex 0 (X)
+                        .append("\x00\x00\x80\xbf", 4) // vertex 0 (Y)
+                        .append("\x00\x00\x00\x00", 4) // vertex 0 (Z)
+                        .append("\x00\x00\x80\x3f", 4) // vertex 1 (X)
+                        .append("\x00\x00\x80\xbf", 4) // vertex 1 (Y)
+                        .append("\x00\x00\x00\x00", 4) // vertex 1 (Z)
+                        .append("\x00\x00\x00\x00", 4) // vertex 2 (X)
+                        .append("\x00\x00\x80\x3f", 4) // vertex 2 (Y)
+                        .append("\x00\x00\x00\x00", 4) // vertex 2 (Z)
+                        .append("\x00\x00\x80\xbf", 4) // vertex 3 (X)
+                        .append("\x00\x00\x80\xbf", 4) // vertex 3 (Y)
+                        .append("\x00\x00\x00\x3f", 4) // vertex 3 (Z)
+                        .append("\x00\x00\x80\x3f", 4) // vertex 4 (X)
+                        .append("\x00\x00\x80\xbf", 4) // vertex 4 (Y)
+                        .append("\x00\x00\x00\x3f", 4) // vertex 4 (Z)
+                        .append("\x00\x00\x00\x00", 4) // vertex 5 (X)
+                        .append("\x00\x00\x80\x3f", 4) // vertex 5 (Y)
+                        .append("\x00\x00\x00\x3f", 4) // vertex 5 (Z)
+                        .append("\x00\x00\x00\x00", 4) // face 0 index 0
+                        .append("\x01\x00\x00\x00", 4) // face 0 index 1
+                        .append("\x02\x00\x00\x00", 4) // face 0 index 2
+                        .append("\x03\x00\x00\x00", 4) // face 1 index 0
+                        .append("\x04\x00\x00\x00", 4) // face 1 index 1
+                        .append("\x05\x00\x00\x00", 4) // face 1 index 2
+                        .append("\x00\x00\x00\x00", 4) // face 0 material
+                        .append("\x00\x00\x00\x00", 4) // face 1 material
+                        .append("\x00\x00\x00\x00", 4) // face 0 normal (X)
+                        .append("\x00\x00\x00\x00", 4) // face 0 normal (Y)
+                        .append("\x00\x00\x80\x3f", 4) // face 0 normal (Z)
+                        .append("\x00\x00\x00\x00", 4) // face 1 normal (X)
+                        .append("\x00\x00\x00\x00", 4) // face 1 normal (Y)
+                        .append("\x00\x00\x80\x3f", 4) // face 1 normal (Z)
+                        .build();
+    auto pwk = ByteArrayInputStream(pwkBytes);
+    auto reader = BwmReader();
+
+    // when
+    reader.load(pwk);
+
+    // then
+    auto walkmesh = reader.walkmesh();
+    BOOST_REQUIRE(static_cast<bool>(walkmesh));
+    BOOST_CHECK(!walkmesh->isAreaWalkmesh());
+    BOOST_CHECK(walkmesh->contains(glm::vec2(0.0f)));
+    float distance = -1.0f;
+    auto face = walkmesh->raycast(SurfaceMask(1), glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 0.0f, -1.0f), 10.0f, distance);
+    BOOST_REQUIRE(static_cast<bool>(face));
+    BOOST_CHECK_EQUAL(1, face->index);
+    BOOST_CHECK_CLOSE(0.5f, distance, 1e-5);
+}
+
 BOOST_AUTO_TEST_CASE(should_load_wok) {
     // given
     auto wokBytes = StringBuilder()
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include "../../src/graphics/lipanimation.h"
+
+using namespace std;
+
+using namespace reone;
+using namespace reone::graphics;
+
+BOOST_AUTO_TEST_SUITE(lip_animation)
+
+BOOST_AUTO_TEST_CASE(should_get_keyframes_at_first_keyframe) {
+    // given
+    auto animation = LipAnimation(
+        "some_lip",
+        2.0f,
+        vector<LipAnimation::Keyframe> {
+            LipAnimation::Keyframe {0.0f, 1},
+            LipAnimation::Keyframe {1.0f, 2},
+            LipAnimation::Keyframe {2.0f, 3}});
+
+    // when
+    uint8_t leftShape = 0;
+    uint8_t rightShape = 0;
+    float factor = -1.0f;
+    bool found = animation.getKeyframes(0.0f, leftShape, rightShape, factor);
+
+    // then
+    BOOST_CHECK(found);
+    BOOST_CHECK_EQUAL(1, static_cast<int>(leftShape));
+    BOOST_CHECK_EQUAL(1, static_cast<int>(rightShape));
+    BOOST_CHECK_EQUAL(0.0f, factor);
+}
+
+BOOST_AUTO_TEST_CASE(should_get_keyframes_using_cursor) {
+    // given
+    auto animation = LipAnimation(
+        "some_lip",
+        2.0f,
+        vector<LipAnimation::Keyframe> {
+            LipAnimation::Keyframe {0.0f, 1},
+            LipAnimation::Keyframe {1.0f, 2},
+            LipAnimation::Keyframe {2.0f, 3}});
+
+    int cursor = 0;
+    uint8_t leftShape = 0;
+    uint8_t rightShape = 0;
+    float factor = -1.0f;
+
+    // when
+    animation.getKeyframes(0.5f, leftShape, rightShape, factor, cursor);
+    int cursor1 = cursor;
+    uint8_t leftShape1 = leftShape;
+    uint8_t rightShape1 = rightShape;
+    float factor1 = factor;
+    animation.getKeyframes(1.5f, leftShape, rightShape, factor, cursor);
+    int cursor2 = cursor;
+    uint8_t leftShape2 = leftShape;
+    uint8_t rightShape2 = rightShape;
+    float factor2 = factor;
+    animation.getKeyframes(0.25f, leftShape, rightShape, factor, cursor);
+    int cursor3 = cursor;
+    float factor3 = factor;
+
+    // then
+    BOOST_CHECK_EQUAL(1, cursor1);
+    BOOST_CHECK_EQUAL(1, static_cast<int>(leftShape1));
+    BOOST_CHECK_EQUAL(2, static_cast<int>(rightShape1));
+    BOOST_CHECK_CLOSE(0.5f, factor1, 1e-5);
+    BOOST_CHECK_EQUAL(2, cursor2);
+    BOOST_CHECK_EQUAL(2, static_cast<int>(leftShape2));
+    BOOST_CHECK_EQUAL(3, static_cast<int>(rightShape2));
+    BOOST_CHECK_CLOSE(0.5f, factor2, 1e-5);
+    BOOST_CHECK_EQUAL(1, cursor3);
+    BOOST_CHECK_CLOSE(0.25f, factor3, 1e-5);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -33,25 +33,18 @@ BOOST_AUTO_TEST_CASE(should_find_ray_walkmesh_intersection__intersection_from_cl
     walkmesh.add(Walkmesh::Face {1, 0, vector<glm::vec3> {glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(-1.0f, 1.0f, 0.0f), glm::vec3(0.0f, 0.0f, 0.0f)}, glm::vec3(1.0f, 0.0f, 0.0f)});
     walkmesh.add(Walkmesh::Face {2, 0, vector<glm::vec3> {glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(1.0f, -1.0f, 0.0f)}, glm::vec3(1.0f, 0.0f, 0.0f)});
     walkmesh.add(Walkmesh::Face {3, 0, vector<glm::vec3> {glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f, -1.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f)}, glm::vec3(1.0f, 0.0f, 0.0f)});
-    auto rootAabb = make_shared<Walkmesh::AABB>();
-    rootAabb->value = AABB(glm::vec3(-1.0f, -1.0f, 0.0f), glm::vec3(1.0f, 1.0f, 0.0f));
-    rootAabb->left = make_shared<Walkmesh::AABB>();
-    rootAabb->left->value = AABB(glm::vec3(-1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
-    rootAabb->left->left = make_shared<Walkmesh::AABB>();
-    rootAabb->left->left->faceIdx = 0;
-    rootAabb->left->right = make_shared<Walkmesh::AABB>();
-    rootAabb->left->right->faceIdx = 1;
-    rootAabb->right = make_shared<Walkmesh::AABB>();
-    rootAabb->right->value = AABB(glm::vec3(0.0f, -1.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f));
-    rootAabb->right->left = make_shared<Walkmesh::AABB>();
-    rootAabb->right->left->faceIdx = 2;
-    rootAabb->right->right = make_shared<Walkmesh::AABB>();
-    rootAabb->right->right->faceIdx = 3;
-    walkmesh.setRootAABB(rootAabb);
+    walkmesh.setAABBNodes(vector<Walkmesh::AABBNode> {
+        Walkmesh::AABBNode {glm::vec3(-1.0f, -1.0f, 0.0f), -1, glm::vec3(1.0f, 1.0f, 0.0f), 4},
+        Walkmesh::AABBNode {glm::vec3(-1.0f, 0.0f, 0.0f), -1, glm::vec3(0.0f, 1.0f, 0.0f), 3},
+        Walkmesh::AABBNode {glm::vec3(-1.0f, 0.0f, 0.0f), 0, glm::vec3(0.0f, 1.0f, 0.0f), -1},
+        Walkmesh::AABBNode {glm::vec3(-1.0f, 0.0f, 0.0f), 1, glm::vec3(0.0f, 1.0f, 0.0f), -1},
+        Walkmesh::AABBNode {glm::vec3(0.0f, -1.0f, 0.0f), -1, glm::vec3(1.0f, 0.0f, 0.0f), 6},
+        Walkmesh::AABBNode {glm::vec3(0.0f, -1.0f, 0.0f), 2, glm::vec3(1.0f, 0.0f, 0.0f), -1},
+        Walkmesh::AABBNode {glm::vec3(0.0f, -1.0f, 0.0f), 3, glm::vec3(1.0f, 0.0f, 0.0f), -1}});
 
     // when
     float distance = -1.0f;
-    auto face = walkmesh.raycast(set<uint32_t> {0}, glm::vec3(-0.5f, 0.25, 1.0f), glm::vec3(0.0f, 0.0f, -1.0f), 10.0f, distance);
+    auto face = walkmesh.raycast(SurfaceMask(1), glm::vec3(-0.5f, 0.25, 1.0f), glm::vec3(0.0f, 0.0f, -1.0f), 10.0f, distance);
 
     // then
     BOOST_REQUIRE(static_cast<bool>(face));
@@ -66,25 +59,18 @@ BOOST_AUTO_TEST_CASE(should_find_ray_walkmesh_intersection__intersection_from_fa
     walkmesh.add(Walkmesh::Face {1, 0, vector<glm::vec3> {glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(-1.0f, 1.0f, 0.0f), glm::vec3(0.0f, 0.0f, 0.0f)}, glm::vec3(1.0f, 0.0f, 0.0f)});
     walkmesh.add(Walkmesh::Face {2, 0, vector<glm::vec3> {glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(1.0f, -1.0f, 0.0f)}, glm::vec3(1.0f, 0.0f, 0.0f)});
     walkmesh.add(Walkmesh::Face {3, 0, vector<glm::vec3> {glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f, -1.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f)}, glm::vec3(1.0f, 0.0f, 0.0f)});
-    auto rootAabb = make_shared<Walkmesh::AABB>();
-    rootAabb->value = AABB(glm::vec3(-1.0f, -1.0f, 0.0f), glm::vec3(1.0f, 1.0f, 0.0f));
-    rootAabb->left = make_shared<Walkmesh::AABB>();
-    rootAabb->left->value = AABB(glm::vec3(-1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
-    rootAabb->left->left = make_shared<Walkmesh::AABB>();
-    rootAabb->left->left->faceIdx = 0;
-    rootAabb->left->right = make_shared<Walkmesh::AABB>();
-    rootAabb->left->right->faceIdx = 1;
-    rootAabb->right = make_shared<Walkmesh::AABB>();
-    rootAabb->right->value = AABB(glm::vec3(0.0f, -1.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f));
-    rootAabb->right->left = make_shared<Walkmesh::AABB>();
-    rootAabb->right->left->faceIdx = 2;
-    rootAabb->right->right = make_shared<Walkmesh::AABB>();
-    rootAabb->right->right->faceIdx = 3;
-    walkmesh.setRootAABB(rootAabb);
+    walkmesh.setAABBNodes(vector<Walkmesh::AABBNode> {
+        Walkmesh::AABBNode {glm::vec3(-1.0f, -1.0f, 0.0f), -1, glm::vec3(1.0f, 1.0f, 0.0f), 4},
+        Walkmesh::AABBNode {glm::vec3(-1.0f, 0.0f, 0.0f), -1, glm::vec3(0.0f, 1.0f, 0.0f), 3},
+        Walkmesh::AABBNode {glm::vec3(-1.0f, 0.0f, 0.0f), 0, glm::vec3(0.0f, 1.0f, 0.0f), -1},
+        Walkmesh::AABBNode {glm::vec3(-1.0f, 0.0f, 0.0f), 1, glm::vec3(0.0f, 1.0f, 0.0f), -1},
+        Walkmesh::AABBNode {glm::vec3(0.0f, -1.0f, 0.0f), -1, glm::vec3(1.0f, 0.0f, 0.0f), 6},
+        Walkmesh::AABBNode {glm::vec3(0.0f, -1.0f, 0.0f), 2, glm::vec3(1.0f, 0.0f, 0.0f), -1},
+        Walkmesh::AABBNode {glm::vec3(0.0f, -1.0f, 0.0f), 3, glm::vec3(1.0f, 0.0f, 0.0f), -1}});
 
     // when
     float distance = -1.0f;
-    auto face = walkmesh.raycast(set<uint32_t> {0}, glm::vec3(-0.5f, 0.25, 20.0f), glm::vec3(0.0f, 0.0f, -1.0f), 10.0f, distance);
+    auto face = walkmesh.raycast(SurfaceMask(1), glm::vec3(-0.5f, 0.25, 20.0f), glm::vec3(0.0f, 0.0f, -1.0f), 10.0f, distance);
 
     // then
     BOOST_REQUIRE(!static_cast<bool>(face));
@@ -97,28 +83,85 @@ BOOST_AUTO_TEST_CASE(should_find_ray_walkmesh_intersection__no_intersection) {
     walkmesh.add(Walkmesh::Face {1, 0, vector<glm::vec3> {glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(-1.0f, 1.0f, 0.0f), glm::vec3(0.0f, 0.0f, 0.0f)}, glm::vec3(1.0f, 0.0f, 0.0f)});
     walkmesh.add(Walkmesh::Face {2, 0, vector<glm::vec3> {glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(1.0f, -1.0f, 0.0f)}, glm::vec3(1.0f, 0.0f, 0.0f)});
     walkmesh.add(Walkmesh::Face {3, 0, vector<glm::vec3> {glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f, -1.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f)}, glm::vec3(1.0f, 0.0f, 0.0f)});
-    auto rootAabb = make_shared<Walkmesh::AABB>();
-    rootAabb->value = AABB(glm::vec3(-1.0f, -1.0f, 0.0f), glm::vec3(1.0f, 1.0f, 0.0f));
-    rootAabb->left = make_shared<Walkmesh::AABB>();
-    rootAabb->left->value = AABB(glm::vec3(-1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
-    rootAabb->left->left = make_shared<Walkmesh::AABB>();
-    rootAabb->left->left->faceIdx = 0;
-    rootAabb->left->right = make_shared<Walkmesh::AABB>();
-    rootAabb->left->right->faceIdx = 1;
-    rootAabb->right = make_shared<Walkmesh::AABB>();
-    rootAabb->right->value = AABB(glm::vec3(0.0f, -1.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f));
-    rootAabb->right->left = make_shared<Walkmesh::AABB>();
-    rootAabb->right->left->faceIdx = 2;
-    rootAabb->right->right = make_shared<Walkmesh::AABB>();
-    rootAabb->right->right->faceIdx = 3;
-    walkmesh.setRootAABB(rootAabb);
+    walkmesh.setAABBNodes(vector<Walkmesh::AABBNode> {
+        Walkmesh::AABBNode {glm::vec3(-1.0f, -1.0f, 0.0f), -1, glm::vec3(1.0f, 1.0f, 0.0f), 4},
+        Walkmesh::AABBNode {glm::vec3(-1.0f, 0.0f, 0.0f), -1, glm::vec3(0.0f, 1.0f, 0.0f), 3},
+        Walkmesh::AABBNode {glm::vec3(-1.0f, 0.0f, 0.0f), 0, glm::vec3(0.0f, 1.0f, 0.0f), -1},
+        Walkmesh::AABBNode {glm::vec3(-1.0f, 0.0f, 0.0f), 1, glm::vec3(0.0f, 1.0f, 0.0f), -1},
+        Walkmesh::AABBNode {glm::vec3(0.0f, -1.0f, 0.0f), -1, glm::vec3(1.0f, 0.0f, 0.0f), 6},
+        Walkmesh::AABBNode {glm::vec3(0.0f, -1.0f, 0.0f), 2, glm::vec3(1.0f, 0.0f, 0.0f), -1},
+        Walkmesh::AABBNode {glm::vec3(0.0f, -1.0f, 0.0f), 3, glm::vec3(1.0f, 0.0f, 0.0f), -1}});
 
     // when
     float distance = -1.0f;
-    auto face = walkmesh.raycast(set<uint32_t> {0}, glm::vec3(-0.5f, 0.25, 1.0f), glm::vec3(1.0f, 0.0f, 0.0f), 10.0f, distance);
+    auto face = walkmesh.raycast(SurfaceMask(1), glm::vec3(-0.5f, 0.25, 1.0f), glm::vec3(1.0f, 0.0f, 0.0f), 10.0f, distance);
 
     // then
     BOOST_REQUIRE(!static_cast<bool>(face));
 }
 
+BOOST_AUTO_TEST_CASE(should_find_closest_ray_walkmesh_intersection) {
+    // given
+    auto walkmesh = Walkmesh();
+    walkmesh.add(Walkmesh::Face {0, 0, vector<glm::vec3> {glm::vec3(-1.0f, -1.0f, 0.5f), glm::vec3(1.0f, -1.0f, 0.5f), glm::vec3(0.0f, 1.0f, 0.5f)}, glm::vec3(0.0f, 0.0f, 1.0f)});
+    walkmesh.add(Walkmesh::Face {1, 0, vector<glm::vec3> {glm::vec3(-1.0f, -1.0f, 0.0f), glm::vec3(1.0f, -1.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f)}, glm::vec3(0.0f, 0.0f, 1.0f)});
+    walkmesh.setAABBNodes(vector<Walkmesh::AABBNode> {
+        Walkmesh::AABBNode {glm::vec3(-1.0f, -1.0f, 0.0f), -1, glm::vec3(1.0f, 1.0f, 0.5f), 2},
+        Walkmesh::AABBNode {glm::vec3(-1.0f, -1.0f, 0.5f), 0, glm::vec3(1.0f, 1.0f, 0.5f), -1},
+        Walkmesh::AABBNode {glm::vec3(-1.0f, -1.0f, 0.0f), 1, glm::vec3(1.0f, 1.0f, 0.0f), -1}});
+
+    // when
+    float distance = -1.0f;
+    auto face = walkmesh.raycast(SurfaceMask(1), glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 0.0f, -1.0f), 10.0f, distance);
+
+    // then
+    BOOST_REQUIRE(static_cast<bool>(face));
+    BOOST_CHECK_EQUAL(0, face->index);
+    BOOST_CHECK_CLOSE(0.5f, distance, 1e-5);
+}
+
+BOOST_AUTO_TEST_CASE(should_find_ray_walkmesh_intersections_in_batch) {
+    // given
+    auto walkmesh = Walkmesh();
+    walkmesh.add(Walkmesh::Face {0, 0, vector<glm::vec3> {glm::vec3(-1.0f, 0.0f, 0.0f), glm::vec3(-1.0f, 1.0f, 0.0f), glm::vec3(0.0f, 0.0f, 0.0f)}, glm::vec3(1.0f, 0.0f, 0.0f)});
+    walkmesh.add(Walkmesh::Face {1, 0, vector<glm::vec3> {glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(-1.0f, 1.0f, 0.0f), glm::vec3(0.0f, 0.0f, 0.0f)}, glm::vec3(1.0f, 0.0f, 0.0f)});
+    walkmesh.add(Walkmesh::Face {2, 0, vector<glm::vec3> {glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(1.0f, -1.0f, 0.0f)}, glm::vec3(1.0f, 0.0f, 0.0f)});
+    walkmesh.add(Walkmesh::Face {3, 0, vector<glm::vec3> {glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f, -1.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f)}, glm::vec3(1.0f, 0.0f, 0.0f)});
+    walkmesh.setAABBNodes(vector<Walkmesh::AABBNode> {
+        Walkmesh::AABBNode {glm::vec3(-1.0f, -1.0f, 0.0f), -1, glm::vec3(1.0f, 1.0f, 0.0f), 4},
+        Walkmesh::AABBNode {glm::vec3(-1.0f, 0.0f, 0.0f), -1, glm::vec3(0.0f, 1.0f, 0.0f), 3},
+        Walkmesh::AABBNode {glm::vec3(-1.0f, 0.0f, 0.0f), 0, glm::vec3(0.0f, 1.0f, 0.0f), -1},
+        Walkmesh::AABBNode {glm::vec3(-1.0f, 0.0f, 0.0f), 1, glm::vec3(0.0f, 1.0f, 0.0f), -1},
+        Walkmesh::AABBNode {glm::vec3(0.0f, -1.0f, 0.0f), -1, glm::vec3(1.0f, 0.0f, 0.0f), 6},
+        Walkmesh::AABBNode {glm::vec3(0.0f, -1.0f, 0.0f), 2, glm::vec3(1.0f, 0.0f, 0.0f), -1},
+        Walkmesh::AABBNode {glm::vec3(0.0f, -1.0f, 0.0f), 3, glm::vec3(1.0f, 0.0f, 0.0f), -1}});
+
+    auto rays = vector<Walkmesh::Ray> {
+        Walkmesh::Ray {glm::vec3(-0.5f, 0.25f, 1.0f), glm::vec3(0.0f, 0.0f, -1.0f), 10.0f},
+        Walkmesh::Ray {glm::vec3(-0.25f, 0.5f, 2.0f), glm::vec3(0.0f, 0.0f, -1.0f), 10.0f},
+        Walkmesh::Ray {glm::vec3(0.5f, -0.75f, 3.0f), glm::vec3(0.0f, 0.0f, -1.0f), 10.0f},
+        Walkmesh::Ray {glm::vec3(-0.5f, 0.25f, 20.0f), glm::vec3(0.0f, 0.0f, -1.0f), 10.0f},
+        Walkmesh::Ray {glm::vec3(2.0f, 2.0f, 1.0f), glm::vec3(0.0f, 0.0f, -1.0f), 10.0f}};
+
+    // when
+    auto faces = vector<const Walkmesh::Face *>();
+    auto distances = vector<float>();
+    walkmesh.raycast(SurfaceMask(1), rays, faces, distances);
+
+    // then
+    BOOST_REQUIRE_EQUAL(5ll, faces.size());
+    BOOST_REQUIRE_EQUAL(5ll, distances.size());
+    BOOST_REQUIRE(static_cast<bool>(faces[0]));
+    BOOST_CHECK_EQUAL(0, faces[0]->index);
+    BOOST_CHECK_CLOSE(1.0f, distances[0], 1e-5);
+    BOOST_REQUIRE(static_cast<bool>(faces[1]));
+    BOOST_CHECK_EQUAL(1, faces[1]->index);
+    BOOST_CHECK_CLOSE(2.0f, distances[1], 1e-5);
+    BOOST_REQUIRE(static_cast<bool>(faces[2]));
+    BOOST_CHECK_EQUAL(3, faces[2]->index);
+    BOOST_CHECK_CLOSE(3.0f, distances[2], 1e-5);
+    BOOST_CHECK(!static_cast<bool>(faces[3]));
+    BOOST_CHECK(!static_cast<bool>(faces[4]));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include "../../src/scene/aabbtree.h"
+
+using namespace std;
+
+using namespace reone;
+using namespace reone::graphics;
+using namespace reone::scene;
+
+static AABB getCellAABB(int x, int y) {
+    auto min = glm::vec3(4.0f * x, 4.0f * y, 0.0f);
+    return AABB(min, min + 1.0f);
+}
+
+static set<int> queryCells(const AABBTree &tree, const AABB &region) {
+    set<int> cells;
+    tree.query(
+        [&region](const AABB &aabb) { return aabb.intersect(region); },
+        [&cells](void *user) { cells.insert(static_cast<int>(reinterpret_cast<intptr_t>(user))); });
+    return move(cells);
+}
+
+BOOST_AUTO_TEST_SUITE(aabb_tree)
+
+BOOST_AUTO_TEST_CASE(should_query_inserted_proxies) {
+    // given
+    auto tree = AABBTree();
+    for (int y = 0; y < 16; ++y) {
+        for (int x = 0; x < 16; ++x) {
+            tree.insert(getCellAABB(x, y), reinterpret_cast<void *>(static_cast<intptr_t>(16 * y + x)));
+        }
+    }
+
+    // when
+    auto cells = queryCells(tree, AABB(glm::vec3(1.8f, 1.8f, 0.5f), glm::vec3(3.2f, 3.2f, 0.5f)));
+
+    // then
+    BOOST_CHECK_EQUAL(256, tree.numProxies());
+    BOOST_CHECK(tree.height() <= 16);
+    auto expectedCells = set<int> {0, 1, 16, 17};
+    BOOST_TEST((expectedCells == cells));
+}
+
+BOOST_AUTO_TEST_CASE(should_refit_moved_and_skip_removed_proxies) {
+    // given
+    auto tree = AABBTree();
+    int first = tree.insert(getCellAABB(0, 0), reinterpret_cast<void *>(1));
+    int second = tree.insert(getCellAABB(1, 0), reinterpret_cast<void *>(2));
+    int third = tree.insert(getCellAABB(2, 0), reinterpret_cast<void *>(3));
+
+    // when
+    bool smallMoveReinserted = tree.move(first, AABB(glm::vec3(0.5f), glm::vec3(1.5f)));
+    bool largeMoveReinserted = tree.move(second, getCellAABB(10, 10));
+    tree.remove(third);
+
+    // then
+    BOOST_CHECK(!smallMoveReinserted);
+    BOOST_CHECK(largeMoveReinserted);
+    BOOST_CHECK_EQUAL(2, tree.numProxies());
+    auto expectedCells = set<int> {2};
+    BOOST_TEST((expectedCells == queryCells(tree, getCellAABB(10, 10))));
+    BOOST_TEST((set<int>() == queryCells(tree, getCellAABB(2, 0))));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include "../../src/scene/node/sound.h"
+
+#include "../fixtures/functional.h"
+
+using namespace std;
+
+using namespace reone;
+using namespace reone::game;
+using namespace reone::scene;
+
+BOOST_AUTO_TEST_SUITE(scene_node)
+
+BOOST_AUTO_TEST_CASE(should_propagate_local_transform_to_descendants) {
+    // given
+    auto test = FunctionalTest();
+    auto &scene = test.sceneMockByName(kSceneMain);
+    auto root = scene.newSound();
+    auto child = scene.newSound();
+    auto grandChild = scene.newSound();
+    child->setLocalTransform(glm::translate(glm::vec3(0.0f, 2.0f, 0.0f)));
+    grandChild->setLocalTransform(glm::translate(glm::vec3(0.0f, 0.0f, 3.0f)));
+    root->addChild(*child);
+    child->addChild(*grandChild);
+    BOOST_CHECK_EQUAL(0.0f, grandChild->getOrigin().x);
+
+    // when
+    root->setLocalTransform(glm::translate(glm::vec3(1.0f, 0.0f, 0.0f)));
+
+    // then
+    auto origin = grandChild->getOrigin();
+    BOOST_CHECK_EQUAL(1.0f, origin.x);
+    BOOST_CHECK_EQUAL(2.0f, origin.y);
+    BOOST_CHECK_EQUAL(3.0f, origin.z);
+    auto localOrigin = grandChild->absoluteTransformInverse() * glm::vec4(1.0f, 2.0f, 3.0f, 1.0f);
+    BOOST_CHECK_SMALL(glm::length(glm::vec3(localOrigin)), 1e-5f);
+}
+
+BOOST_AUTO_TEST_CASE(should_reset_absolute_transform_when_child_removed) {
+    // given
+    auto test = FunctionalTest();
+    auto &scene = test.sceneMockByName(kSceneMain);
+    auto root = scene.newSound();
+    auto child = scene.newSound();
+    root->setLocalTransform(glm::translate(glm::vec3(1.0f, 0.0f, 0.0f)));
+    child->setLocalTransform(glm::translate(glm::vec3(0.0f, 2.0f, 0.0f)));
+    root->addChild(*child);
+    BOOST_CHECK_EQUAL(1.0f, child->getOrigin().x);
+
+    // when
+    root->removeChild(*child);
+
+    // then
+    BOOST_CHECK_EQUAL(0ll, root->children().size());
+    BOOST_CHECK_EQUAL(0.0f, child->getOrigin().x);
+    BOOST_CHECK_EQUAL(2.0f, child->getOrigin().y);
+}
+
+BOOST_AUTO_TEST_CASE(should_remove_children_by_index) {
+    // given
+    auto test = FunctionalTest();
+    auto &scene = test.sceneMockByName(kSceneMain);
+    auto root = scene.newSound();
+    auto other = scene.newSound();
+    auto child1 = scene.newSound();
+    auto child2 = scene.newSound();
+    auto child3 = scene.newSound();
+    auto child4 = scene.newSound();
+    root->addChild(*child1);
+    root->addChild(*child2);
+    root->addChild(*child3);
+    root->addChild(*child4);
+    root->addChild(*child2);
+
+    // when
+    root->removeChild(*child1);
+    other->addChild(*child3);
+    root->removeChildrenIf([&child4](SceneNode &node) { return &node == child4.get(); });
+    root->removeChild(*child3);
+
+    // then
+    auto expectedChildren = vector<SceneNode *> {child2.get()};
+    BOOST_TEST((expectedChildren == root->children()));
+    BOOST_TEST((!child1->parent()));
+    BOOST_CHECK_EQUAL(other.get(), child3->parent());
+    BOOST_CHECK_EQUAL(1ll, other->children().size());
+    BOOST_TEST((!child4->parent()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
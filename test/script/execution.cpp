@@ -20,6 +20,7 @@
 #include "../../script/execution.h"
 #include "../../script/executioncontext.h"
 #include "../../script/executionstate.h"
+#include "../../script/profiler.h"
 #include "../../script/program.h"
 
 #include "../fixtures/script.h"
@@ -203,6 +204,34 @@ BOOST_AUTO_TEST_CASE(should_run_script_program__loop) {
     BOOST_CHECK_EQUAL(10, result);
 }
 
+BOOST_AUTO_TEST_CASE(should_run_script_program__in_slices) {
+    // given
+    auto program = make_shared<ScriptProgram>("some_program");
+    program->add(Instruction::newCONSTI(0));
+    program->add(Instruction::newCONSTI(10));
+    program->add(Instruction::newCPTOPSP(-8, 8));
+    program->add(Instruction(InstructionType::LTII));
+    program->add(Instruction::newJZ(18));
+    program->add(Instruction::newINCISP(-8));
+    program->add(Instruction::newJMP(-22));
+    program->add(Instruction::newMOVSP(-4));
+
+    auto context = make_unique<ExecutionContext>();
+    auto execution = ScriptExecution(program, move(context));
+
+    // when
+    int numSlices = 1;
+    while (!execution.runSlice(5)) {
+        ++numSlices;
+    }
+
+    // then
+    BOOST_CHECK(execution.isFinished());
+    BOOST_CHECK_EQUAL(10, execution.result());
+    BOOST_CHECK_EQUAL(56ll, execution.instructionsExecuted());
+    BOOST_CHECK_EQUAL(12, numSlices);
+}
+
 BOOST_AUTO_TEST_CASE(should_run_script_program__action) {
     // given
     auto program = make_shared<ScriptProgram>("some_program");
@@ -235,6 +264,42 @@ BOOST_AUTO_TEST_CASE(should_run_script_program__action) {
     BOOST_CHECK_EQUAL(1, get<0>(invocation[0])[1].intValue);
 }
 
+BOOST_AUTO_TEST_CASE(should_run_script_program__profiling) {
+    // given
+    auto program = make_shared<ScriptProgram>("some_program");
+    program->add(Instruction::newCONSTI(1));
+    program->add(Instruction::newCONSTS("some_tag"));
+    program->add(Instruction::newACTION(0, 2));
+
+    auto routine = make_shared<MockRoutine>(
+        "SomeAction",
+        VariableType::Object,
+        Variable::ofObject(kObjectInvalid),
+        vector<VariableType> {VariableType::String, VariableType::Int});
+
+    auto routines = MockRoutines();
+    routines.add(0, routine);
+
+    auto profiler = ScriptProfiler();
+
+    auto context = make_unique<ExecutionContext>();
+    context->routines = &routines;
+    context->profiler = &profiler;
+
+    auto execution = ScriptExecution(program, move(context));
+
+    // when
+    execution.run();
+
+    // then
+    BOOST_CHECK_EQUAL(1ll, profiler.scriptStats().size());
+    auto &scriptStats = profiler.scriptStats().at("some_program");
+    BOOST_CHECK_EQUAL(1, scriptStats.runs);
+    BOOST_CHECK_EQUAL(3ll, scriptStats.instructions);
+    BOOST_CHECK_EQUAL(1ll, profiler.routineStats().size());
+    BOOST_CHECK_EQUAL(1, profiler.routineStats().at("SomeAction").calls);
+}
+
 BOOST_AUTO_TEST_CASE(should_run_script_program__action_with_vectors) {
     // given
     auto program = make_shared<ScriptProgram>("some_program");
@@ -317,11 +382,77 @@ BOOST_AUTO_TEST_CASE(should_run_script_program__action_with_store_state) {
     auto &actionContext = get<0>(routineInvocation)[0].context;
     BOOST_CHECK(static_cast<bool>(actionContext));
     BOOST_CHECK(static_cast<bool>(actionContext->savedState));
-    BOOST_CHECK_EQUAL(2, actionContext->savedState->globals.size());
-    BOOST_CHECK_EQUAL(2, actionContext->savedState->globals[0].intValue);
-    BOOST_CHECK_EQUAL(3, actionContext->savedState->globals[1].intValue);
-    BOOST_CHECK_EQUAL(1, actionContext->savedState->locals.size());
-    BOOST_CHECK_EQUAL(5, actionContext->savedState->locals[0].intValue);
+    BOOST_CHECK_EQUAL(2, actionContext->savedState->globals->size());
+    BOOST_CHECK_EQUAL(2, (*actionContext->savedState->globals)[0].intValue);
+    BOOST_CHECK_EQUAL(3, (*actionContext->savedState->globals)[1].intValue);
+    BOOST_CHECK_EQUAL(1, actionContext->savedState->locals->size());
+    BOOST_CHECK_EQUAL(5, (*actionContext->savedState->locals)[0].intValue);
+}
+
+BOOST_AUTO_TEST_CASE(should_run_script_program__saved_state) {
+    // given
+    auto program = make_shared<ScriptProgram>("some_program");
+    program->add(Instruction::newCPTOPBP(-8, 4));
+    program->add(Instruction::newINCIBP(-4));
+    program->add(Instruction::newCPTOPBP(-4, 4));
+    program->add(Instruction(InstructionType::ADDII));
+    program->add(Instruction(InstructionType::ADDII));
+    program->add(Instruction(InstructionType::RETN));
+
+    auto savedState = make_shared<ExecutionState>();
+    savedState->program = program;
+    savedState->globals = make_shared<vector<Variable>>(vector<Variable> {Variable::ofInt(2), Variable::ofInt(3)});
+    savedState->locals = make_shared<vector<Variable>>(vector<Variable> {Variable::ofInt(5)});
+    savedState->insOffset = 13;
+
+    auto routines = MockRoutines();
+
+    auto context = make_unique<ExecutionContext>();
+    context->routines = &routines;
+    context->savedState = savedState;
+
+    auto execution = ScriptExecution(program, move(context));
+
+    // when
+    auto result = execution.run();
+
+    // then
+    BOOST_CHECK_EQUAL(11, result);
+    BOOST_CHECK_EQUAL(3, execution.getStackSize());
+    BOOST_CHECK_EQUAL(2, execution.getStackVariable(0).intValue);
+    BOOST_CHECK_EQUAL(4, execution.getStackVariable(1).intValue);
+    BOOST_CHECK_EQUAL(3, (*savedState->globals)[1].intValue);
+}
+
+BOOST_AUTO_TEST_CASE(should_run_script_program__saved_state_without_locals) {
+    // given
+    auto program = make_shared<ScriptProgram>("some_program");
+    program->add(Instruction(InstructionType::NEGI));
+    program->add(Instruction(InstructionType::ADDII));
+    program->add(Instruction(InstructionType::RETN));
+
+    auto savedState = make_shared<ExecutionState>();
+    savedState->program = program;
+    savedState->globals = make_shared<vector<Variable>>(vector<Variable> {Variable::ofInt(2), Variable::ofInt(3)});
+    savedState->locals = make_shared<vector<Variable>>();
+    savedState->insOffset = 13;
+
+    auto routines = MockRoutines();
+
+    auto context = make_unique<ExecutionContext>();
+    context->routines = &routines;
+    context->savedState = savedState;
+
+    auto execution = ScriptExecution(program, move(context));
+
+    // when
+    auto result = execution.run();
+
+    // then
+    BOOST_CHECK_EQUAL(-1, result);
+    BOOST_CHECK_EQUAL(1, execution.getStackSize());
+    BOOST_CHECK_EQUAL(2, (*savedState->globals)[0].intValue);
+    BOOST_CHECK_EQUAL(3, (*savedState->globals)[1].intValue);
 }
 
 BOOST_AUTO_TEST_CASE(should_run_script_program__globals) {
@@ -461,4 +592,48 @@ BOOST_AUTO_TEST_CASE(should_run_script_program__structs) {
     BOOST_CHECK_EQUAL(1, result);
 }
 
+BOOST_AUTO_TEST_CASE(should_run_script_program__superinstructions) {
+    // given
+    auto newProgram = []() {
+        auto program = make_shared<ScriptProgram>("some_program");
+        program->add(Instruction::newCONSTI(5));             // 5
+        program->add(Instruction(InstructionType::RSADDI));  // 5, 0
+        program->add(Instruction::newCPDOWNSP(-8, 4));       // 0, 0
+        program->add(Instruction::newMOVSP(-4));             // 0
+        program->add(Instruction::newCONSTI(3));             // 0, 3
+        program->add(Instruction::newCPDOWNSP(-8, 4));       // 3, 3
+        program->add(Instruction::newMOVSP(-4));             // 3
+        program->add(Instruction::newCPTOPSP(-4, 4));        // 3, 3
+        program->add(Instruction::newCONSTI(3));             // 3, 3, 3
+        program->add(Instruction(InstructionType::EQUALII)); // 3, 1
+        program->add(Instruction::newJZ(14));                // 3
+        program->add(Instruction::newCONSTI(10));            // 3, 10
+        program->add(Instruction(InstructionType::ADDII));   // 13
+        program->add(Instruction::newCPTOPSP(-4, 4));        // 13, 13
+        program->add(Instruction::newCONSTI(3));             // 13, 13, 3
+        program->add(Instruction(InstructionType::EQUALII)); // 13, 0
+        program->add(Instruction::newJZ(14));                // 13
+        program->add(Instruction::newCONSTI(100));
+        program->add(Instruction(InstructionType::ADDII));
+        program->add(Instruction::newCONSTI(1));           // 13, 1
+        program->add(Instruction(InstructionType::ADDII)); // 14
+        return program;
+    };
+    auto program = newProgram();
+    auto fusedProgram = newProgram();
+    fusedProgram->fuseInstructions();
+
+    auto execution = ScriptExecution(program, make_unique<ExecutionContext>());
+    auto fusedExecution = ScriptExecution(fusedProgram, make_unique<ExecutionContext>());
+
+    // when
+    auto result = execution.run();
+    auto fusedResult = fusedExecution.run();
+
+    // then
+    BOOST_CHECK_EQUAL(14, result);
+    BOOST_CHECK_EQUAL(result, fusedResult);
+    BOOST_CHECK_EQUAL(execution.getStackSize(), fusedExecution.getStackSize());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -17,6 +17,7 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include "../../../src/common/exception/validation.h"
 #include "../../../src/common/stream/bytearrayinput.h"
 #include "../../../src/common/stringbuilder.h"
 #include "../../../src/script/format/ncsreader.h"
@@ -271,4 +272,22 @@ BOOST_AUTO_TEST_CASE(should_read_ncs) {
     BOOST_CHECK_EQUAL(static_cast<int>(InstructionType::NOP2), static_cast<int>(program->getInstruction(298).type));
 }
 
+BOOST_AUTO_TEST_CASE(should_throw_on_truncated_instruction) {
+    // given
+
+    auto input = StringBuilder()
+                     .append("NCS V1.0")
+                     .append("\x42\x00\x00\x00\x19", 5)         // T
+                     .append("\x04\x03\x00\x00\x00\x01", 6)     // CONSTI
+                     .append("\x01\x01\xff\xff\xff\xfc", 6)     // CPDOWNSP, missing size
+                     .build();
+
+    auto stream = ByteArrayInputStream(input);
+    auto reader = NcsReader("");
+
+    // when, then
+
+    BOOST_CHECK_THROW(reader.load(stream), ValidationException);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
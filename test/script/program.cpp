@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2020-2022 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include "../../script/program.h"
+
+using namespace std;
+
+using namespace reone;
+using namespace reone::script;
+
+BOOST_AUTO_TEST_SUITE(script_program)
+
+BOOST_AUTO_TEST_CASE(should_fuse_instructions) {
+    // given
+    auto program = ScriptProgram("some_program");
+    program.add(Instruction::newCPTOPSP(-4, 4));
+    program.add(Instruction::newCONSTI(1));
+    program.add(Instruction(InstructionType::EQUALII));
+    program.add(Instruction::newJZ(6));
+    program.add(Instruction(InstructionType::RSADDS));
+    program.add(Instruction::newCPDOWNSP(-8, 4));
+    program.add(Instruction::newMOVSP(-4));
+    program.add(Instruction::newCPDOWNSP(-8, 4));
+    program.add(Instruction::newMOVSP(-4));
+
+    // when
+    program.fuseInstructions();
+
+    // then
+    auto instructions = program.instructions();
+    BOOST_TEST((SuperInstructionType::CPTOPSP_CONSTI_EQUALII_JZ == instructions[0].superType));
+    BOOST_CHECK_EQUAL(4, instructions[0].superCount);
+    BOOST_TEST((SuperInstructionType::RSADDx_CPDOWNSP_MOVSP == instructions[4].superType));
+    BOOST_CHECK_EQUAL(3, instructions[4].superCount);
+    BOOST_TEST((SuperInstructionType::CPDOWNSP_MOVSP == instructions[7].superType));
+    BOOST_CHECK_EQUAL(2, instructions[7].superCount);
+}
+
+BOOST_AUTO_TEST_CASE(should_not_fuse_instructions_across_jump_target) {
+    // given
+    auto program = ScriptProgram("some_program");
+    program.add(Instruction::newCPDOWNSP(-8, 4)); // 13
+    program.add(Instruction::newMOVSP(-4));       // 21
+    program.add(Instruction::newJMP(-6));         // 27
+
+    // when
+    program.fuseInstructions();
+
+    // then
+    auto instructions = program.instructions();
+    BOOST_TEST((SuperInstructionType::None == instructions[0].superType));
+    BOOST_TEST((SuperInstructionType::None == instructions[1].superType));
+}
+
+BOOST_AUTO_TEST_SUITE_END()